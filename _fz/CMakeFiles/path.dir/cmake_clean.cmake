@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/path.dir/path.c.o"
+  "CMakeFiles/path.dir/path.c.o.d"
+  "libpath.a"
+  "libpath.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/path.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
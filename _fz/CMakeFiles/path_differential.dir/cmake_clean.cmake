@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/path_differential.dir/fuzz/path_differential.c.o"
+  "CMakeFiles/path_differential.dir/fuzz/path_differential.c.o.d"
+  "path_differential"
+  "path_differential.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/path_differential.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
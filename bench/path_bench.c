@@ -0,0 +1,230 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+// ============= FLUENT LIB C =============
+// Path Benchmarks
+// ----------------------------------------
+// Times the lexical entry points of the library on a synthetic path corpus.
+// The same corpus is used as PGO training input (see bench/run_configs.sh).
+//
+// Usage:
+//   path_bench [scale]   – scale multiplies the iteration counts (default 1)
+//
+// Output: one "<name> <ns/op>" line per benchmark, for run_configs.sh to compare.
+//
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_builder.h"
+#include "path_compare.h"
+#include "path_ext.h"
+#include "path_glob.h"
+#include "path_hash.h"
+#include "path_sanitize.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// ============= MACROS =============
+#define BENCH_CORPUS 4096 // Number of distinct paths
+#define BENCH_ROUNDS 64   // Passes over the corpus per benchmark (times scale)
+
+// ============= GLOBALS =============
+static char *bench_corpus[BENCH_CORPUS];
+static char *bench_upper[BENCH_CORPUS]; // Same paths, uppercased (for case-folding compares)
+static volatile uint64_t bench_sink;    // Keeps results alive
+
+// ============= HELPERS =============
+/**
+ * @brief Returns a monotonic timestamp in nanoseconds.
+ */
+static uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Fills the corpus with deterministic, source-tree-like paths.
+ */
+static void bench_build_corpus(void)
+{
+    static const char *dirs[] = { "src", "include", "lib", "vendor", "docs", "build", "test", "node_modules", "assets" };
+    static const char *names[] = { "main", "util", "parser", "README", "index", "config", "Makefile", "image", "archive" };
+    static const char *exts[] = { ".c", ".h", ".md", ".png", ".tar.gz", ".json", "", ".js", ".o" };
+
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < BENCH_CORPUS; i++)
+    {
+        char path[512];
+        size_t len = 0;
+        const int depth = 2 + (int)(seed % 6);
+        for (int d = 0; d < depth; d++)
+        {
+            seed = seed * 1103515245u + 12345u;
+            len += (size_t)snprintf(path + len, sizeof(path) - len, "/%s", dirs[(seed >> 16) % 9]);
+            if ((seed >> 8) % 7 == 0)
+            {
+                len += (size_t)snprintf(path + len, sizeof(path) - len, "/./"); // Noise for the normalizers
+            }
+        }
+
+        seed = seed * 1103515245u + 12345u;
+        snprintf(path + len, sizeof(path) - len, "/%s_%zu%s", names[(seed >> 16) % 9], i, exts[(seed >> 20) % 9]);
+
+        bench_corpus[i] = strdup(path);
+        bench_upper[i] = strdup(path);
+        for (char *c = bench_upper[i]; *c; c++)
+        {
+            if (*c >= 'a' && *c <= 'z')
+            {
+                *c = (char)(*c - 32);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Prints one result line.
+ */
+static void bench_report(const char *const name, const uint64_t start, const size_t ops)
+{
+    printf("%-24s %10.2f\n", name, (double)(bench_now() - start) / (double)ops);
+}
+
+// ============= BENCHMARKS =============
+int main(const int argc, char **argv)
+{
+    const size_t scale = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 1;
+    const size_t rounds = BENCH_ROUNDS * (scale ? scale : 1);
+    const size_t ops = rounds * BENCH_CORPUS;
+    bench_build_corpus();
+
+    uint64_t start = bench_now();
+    for (size_t r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < BENCH_CORPUS; i++)
+        {
+            bench_sink += path_hash(bench_corpus[i]);
+        }
+    }
+    bench_report("path_hash", start, ops);
+
+    start = bench_now();
+    for (size_t r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < BENCH_CORPUS; i++)
+        {
+            bench_sink += (uint64_t)path_compare(bench_corpus[i], bench_upper[i], PATH_COMPARE_CASE_FOLD | PATH_COMPARE_NFC);
+        }
+    }
+    bench_report("path_compare_fold", start, ops);
+
+    start = bench_now();
+    for (size_t r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < BENCH_CORPUS; i++)
+        {
+            bench_sink += path_compare_hash(bench_upper[i], PATH_COMPARE_CASE_FOLD);
+        }
+    }
+    bench_report("path_compare_hash", start, ops);
+
+    start = bench_now();
+    for (size_t r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < BENCH_CORPUS; i++)
+        {
+            char out[FLUENT_LIBC_PATH_MAX];
+            size_t len = 0;
+            bench_sink += (uint64_t)path_sanitize_into(bench_corpus[i], out, sizeof(out), 0, &len) + len;
+        }
+    }
+    bench_report("path_sanitize_into", start, ops);
+
+    start = bench_now();
+    for (size_t r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < BENCH_CORPUS; i++)
+        {
+            char *name = get_file_name(bench_corpus[i]);
+            bench_sink += (uint64_t)(unsigned char)name[0];
+            free(name);
+        }
+    }
+    bench_report("get_file_name", start, ops);
+
+    // Extension classification
+    const path_ext_entry_t entries[] = {
+        { ".c", 1 }, { ".h", 2 }, { ".md", 3 }, { ".png", 4 }, { ".tar.gz", 5 }, { ".json", 6 }, { ".js", 7 },
+    };
+    path_ext_table_t table;
+    if (path_ext_table_build(&table, entries, sizeof(entries) / sizeof(entries[0]), 0, PATH_EXT_CASE_INSENSITIVE))
+    {
+        start = bench_now();
+        for (size_t r = 0; r < rounds; r++)
+        {
+            for (size_t i = 0; i < BENCH_CORPUS; i++)
+            {
+                bench_sink += (uint64_t)path_extension_classify(&table, bench_corpus[i]);
+            }
+        }
+        bench_report("path_extension_classify", start, ops);
+        path_ext_table_destroy(&table);
+    }
+
+    // Glob matching (gitignore-style rule set)
+    const char *patterns[] = { "*.o", "build/", "node_modules/", "**/vendor/**/*.js", "docs/*.md", "!docs/README*" };
+    path_glob_t glob;
+    if (path_glob_compile(&glob, patterns, sizeof(patterns) / sizeof(patterns[0])))
+    {
+        start = bench_now();
+        for (size_t r = 0; r < rounds; r++)
+        {
+            for (size_t i = 0; i < BENCH_CORPUS; i++)
+            {
+                bench_sink += (uint64_t)path_glob_match(&glob, bench_corpus[i], 0);
+            }
+        }
+        bench_report("path_glob_match", start, ops);
+        path_glob_destroy(&glob);
+    }
+
+    // Builder push/pop, as in a recursive traversal
+    path_builder_t builder;
+    if (path_builder_init(&builder, "/srv"))
+    {
+        start = bench_now();
+        for (size_t r = 0; r < rounds; r++)
+        {
+            for (size_t i = 0; i < BENCH_CORPUS; i++)
+            {
+                path_builder_push(&builder, "component");
+                path_builder_push(&builder, "file.txt");
+                bench_sink += path_builder_view(&builder).len;
+                path_builder_pop(&builder);
+                path_builder_pop(&builder);
+            }
+        }
+        bench_report("path_builder_push_pop", start, ops);
+        path_builder_destroy(&builder);
+    }
+
+    for (size_t i = 0; i < BENCH_CORPUS; i++)
+    {
+        free(bench_corpus[i]);
+        free(bench_upper[i]);
+    }
+
+    return 0;
+}
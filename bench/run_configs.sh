@@ -0,0 +1,77 @@
+#!/bin/sh
+#
+# This code is distributed under the terms of the GNU General Public License.
+# For more information, please refer to the LICENSE file in the root directory.
+# -------------------------------------------------
+# Copyright (C) 2025 Rodrigo R.
+#
+# Builds path_bench in every performance configuration and reports the
+# speedup of each one over the default Release build.
+#
+# Usage:
+#   bench/run_configs.sh [build-root] [scale]
+#
+# Configurations:
+#   baseline  – Release, default flags
+#   ipo       – PATH_ENABLE_IPO=ON (LTO across libpath.a and the caller)
+#   native    – PATH_MARCH=native
+#   x86-64-v3 – PATH_MARCH=x86-64-v3 (skipped if the CPU or compiler lacks it)
+#   dispatch  – PATH_DISPATCH=ON (per-CPU clones picked at load time)
+#   pgo       – PATH_PGO=GENERATE, a training run on the benchmark corpus, then PATH_PGO=USE
+#               in the same build tree (so the profiles match the objects)
+#
+
+set -eu
+
+SRC=$(cd "$(dirname "$0")/.." && pwd)
+ROOT=${1:-"$SRC/_bench"}
+SCALE=${2:-1}
+mkdir -p "$ROOT"
+
+# configure <name> [cmake args...]: configures and builds one tree
+configure() {
+    name=$1
+    shift
+    cmake -S "$SRC" -B "$ROOT/$name" -DCMAKE_BUILD_TYPE=Release -DPATH_BUILD_BENCHMARKS=ON "$@" > "$ROOT/$name.log" 2>&1 &&
+        cmake --build "$ROOT/$name" >> "$ROOT/$name.log" 2>&1
+}
+
+# run <name> [cmake args...]: builds one configuration and records its timings
+run() {
+    name=$1
+    shift
+    if configure "$name" "$@" && "$ROOT/$name/path_bench" "$SCALE" > "$ROOT/$name.txt"; then
+        echo "built $name"
+    else
+        echo "skipped $name (see $ROOT/$name.log)"
+        rm -f "$ROOT/$name.txt"
+    fi
+}
+
+run baseline
+run ipo -DPATH_ENABLE_IPO=ON
+run native -DPATH_MARCH=native
+run x86-64-v3 -DPATH_MARCH=x86-64-v3
+run dispatch -DPATH_DISPATCH=ON
+
+# PGO: instrument, train, rebuild the same tree with the profiles
+rm -rf "$ROOT/pgo/pgo"
+if configure pgo -DPATH_PGO=GENERATE -DPATH_PGO_DIR="$ROOT/pgo/pgo" && "$ROOT/pgo/path_bench" "$SCALE" > /dev/null; then
+    if ls "$ROOT"/pgo/pgo/*.profraw > /dev/null 2>&1; then
+        llvm-profdata merge -o "$ROOT/pgo/pgo/path.profdata" "$ROOT"/pgo/pgo/*.profraw # Clang
+    fi
+    run pgo -DPATH_PGO=USE -DPATH_PGO_DIR="$ROOT/pgo/pgo"
+else
+    echo "skipped pgo (see $ROOT/pgo.log)"
+fi
+
+# Report: ns/op per configuration and the speedup over baseline
+echo
+for result in "$ROOT"/*.txt; do
+    name=$(basename "$result" .txt)
+    [ "$name" = baseline ] && continue
+    echo "== $name (speedup over baseline)"
+    awk 'NR == FNR { base[$1] = $2; next }
+         ($1 in base) && $2 > 0 { printf "  %-24s %10.2f ns/op  %6.2fx\n", $1, $2, base[$1] / $2 }' \
+        "$ROOT/baseline.txt" "$result"
+done
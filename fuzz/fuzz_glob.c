@@ -0,0 +1,95 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+// ============= FLUENT LIB C =============
+// libFuzzer target: glob compilation, matching and extension lookup
+// ----------------------------------------
+// The input holds newline-separated patterns, then a NUL byte, then a path.
+// The patterns are compiled and matched against the path and its parents.
+// Each pattern is also used as an extension table entry and classified.
+//
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_ext.h"
+#include "path_glob.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============= MACROS =============
+#define FUZZ_MAX_PATTERNS 64
+
+// ============= HELPERS =============
+/**
+ * @brief Aborts with a message when an invariant does not hold.
+ */
+static void fuzz_check(const int condition, const char *const what)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "invariant violated: %s\n", what);
+        abort();
+    }
+}
+
+// ============= ENTRY POINT =============
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    char *copy = (char *)malloc(size + 1);
+    if (!copy)
+    {
+        return 0;
+    }
+    memcpy(copy, data, size);
+    copy[size] = '\0';
+
+    // Patterns up to the first NUL, path after it
+    const size_t patterns_len = strlen(copy);
+    const char *path = patterns_len < size ? copy + patterns_len + 1 : "";
+    const char *patterns[FUZZ_MAX_PATTERNS];
+    path_ext_entry_t entries[FUZZ_MAX_PATTERNS];
+    size_t count = 0;
+    for (char *line = copy; line && count < FUZZ_MAX_PATTERNS; count++)
+    {
+        char *newline = strchr(line, '\n');
+        if (newline)
+        {
+            *newline = '\0';
+        }
+        patterns[count] = line;
+        entries[count].extension = line;
+        entries[count].value = (int)count + 1;
+        line = newline ? newline + 1 : NULL;
+    }
+
+    path_glob_t glob;
+    if (path_glob_compile(&glob, patterns, count))
+    {
+        // The same query twice must agree (the second hits the transition cache)
+        const int first = path_glob_match(&glob, path, 0);
+        fuzz_check(first == path_glob_match(&glob, path, 0), "glob match is deterministic");
+        fuzz_check(path_glob_match_slice(&glob, path_slice(path), 1) == path_glob_match(&glob, path, 1), "slice agrees");
+        path_glob_destroy(&glob);
+    }
+
+    path_ext_table_t table;
+    if (path_ext_table_build(&table, entries, count, -1, PATH_EXT_CASE_INSENSITIVE))
+    {
+        const int value = path_extension_classify(&table, path);
+        fuzz_check(value >= -1 && value <= (int)count, "classified value comes from the table");
+        fuzz_check(value == path_extension_classify_slice(&table, path_slice(path)), "slice agrees");
+        path_ext_table_destroy(&table);
+    }
+
+    free(copy);
+    return 0;
+}
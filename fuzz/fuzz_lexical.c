@@ -0,0 +1,135 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+// ============= FLUENT LIB C =============
+// libFuzzer target: lexical fast paths
+// ----------------------------------------
+// Checks the invariants tying the lexical helpers together:
+//   - path_sanitize_into() is idempotent and preserves path_hash();
+//   - path_hash_append() extends path_hash() of the parent;
+//   - path_compare() is antisymmetric and equal paths have equal path_compare_hash();
+//   - path_builder_t push/pop restore the previous view byte for byte.
+//
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_builder.h"
+#include "path_compare.h"
+#include "path_hash.h"
+#include "path_sanitize.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============= HELPERS =============
+/**
+ * @brief Aborts with a message when an invariant does not hold.
+ */
+static void fuzz_check(const int condition, const char *const what)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "invariant violated: %s\n", what);
+        abort();
+    }
+}
+
+// ============= ENTRY POINT =============
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    const path_slice_t input = path_slice_from((const char *)data, size);
+
+    // Sanitization: idempotent, and a no-op for path_hash (same lexical form)
+    char clean[FLUENT_LIBC_PATH_MAX];
+    size_t clean_len = 0;
+    if (path_sanitize_into_slice(input, clean, sizeof(clean), 0, &clean_len))
+    {
+        fuzz_check(clean_len == strlen(clean), "sanitized length");
+        fuzz_check(path_hash_slice(input) == path_hash(clean), "path_hash(input) == path_hash(sanitized)");
+
+        char again[FLUENT_LIBC_PATH_MAX];
+        size_t again_len = 0;
+        fuzz_check(path_sanitize_into(clean, again, sizeof(again), 0, &again_len), "sanitized output is valid");
+        fuzz_check(again_len == clean_len && memcmp(again, clean, clean_len) == 0, "sanitize is idempotent");
+
+        // Incremental hashing of the sanitized components
+        const int absolute = clean[0] == PATH_SEPARATOR;
+        uint64_t hash = path_hash_root(absolute);
+        const char *p = clean + absolute;
+        while (*p && strcmp(clean, ".") != 0)
+        {
+            const char *end = strchr(p, PATH_SEPARATOR);
+            const size_t len = end ? (size_t)(end - p) : strlen(p);
+            if (!(len == 2 && p[0] == '.' && p[1] == '.'))
+            {
+                hash = path_hash_append(hash, p, len);
+            }
+            else
+            {
+                hash = 0; // Leading ".." is only kept with PATH_SANITIZE_ALLOW_PARENT
+                break;
+            }
+            p += len + (end ? 1 : 0);
+        }
+        fuzz_check(!hash || hash == path_hash(clean), "path_hash_append chain == path_hash");
+    }
+
+    // Replacement mode never fails on content, only on length. Every byte can
+    // grow into a 3-byte U+FFFD, so size the buffer for the worst case ("."
+    // for an empty input, plus the NUL)
+    const size_t replaced_cap = size * 3 + 2;
+    char *replaced = (char *)malloc(replaced_cap);
+    if (replaced)
+    {
+        fuzz_check(
+            path_sanitize_into_slice(input, replaced, replaced_cap, PATH_SANITIZE_REPLACE | PATH_SANITIZE_ALLOW_PARENT, NULL),
+            "replacement mode accepts any input"
+        );
+        free(replaced);
+    }
+
+    // Comparison: split the input in two halves
+    const path_slice_t a = path_slice_from(input.ptr, size / 2);
+    const path_slice_t b = path_slice_from(input.ptr + size / 2, size - size / 2);
+    for (int flags = 0; flags < 4; flags++)
+    {
+        const int ab = path_compare_slice(a, b, flags);
+        const int ba = path_compare_slice(b, a, flags);
+        fuzz_check((ab > 0) == (ba < 0) && (ab == 0) == (ba == 0), "path_compare is antisymmetric");
+        fuzz_check(path_compare_slice(a, a, flags) == 0, "path_compare is reflexive");
+        fuzz_check(ab != 0 || path_compare_hash_slice(a, flags) == path_compare_hash_slice(b, flags), "equal paths hash equal");
+    }
+
+    // Builder: push every input byte run between NULs, then pop back
+    path_builder_t builder;
+    if (path_builder_init(&builder, "/root"))
+    {
+        size_t start = 0;
+        size_t pushed = 0;
+        for (size_t i = 0; i <= size; i++)
+        {
+            if (i == size || data[i] == '\0')
+            {
+                fuzz_check(path_builder_push_slice(&builder, path_slice_from((const char *)data + start, i - start)), "push");
+                pushed++;
+                start = i + 1;
+            }
+        }
+        fuzz_check(path_builder_depth(&builder) == pushed, "builder depth");
+        while (path_builder_pop(&builder))
+        {
+        }
+        fuzz_check(strcmp(path_builder_view(&builder).ptr, "/root") == 0, "pop restores the root");
+        path_builder_destroy(&builder);
+    }
+
+    return 0;
+}
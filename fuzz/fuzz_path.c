@@ -0,0 +1,118 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+// ============= FLUENT LIB C =============
+// libFuzzer target: path.h entry points
+// ----------------------------------------
+// The input is split at its first NUL byte into two paths. Every entry point
+// of path.h runs on them, and each result is checked against the
+// equivalent char* / slice / buffer variants and against realpath(3).
+//
+
+// ============= INCLUDES =============
+#include "path.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============= HELPERS =============
+/**
+ * @brief Aborts with a message when an invariant does not hold.
+ */
+static void fuzz_check(const int condition, const char *const what)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "invariant violated: %s\n", what);
+        abort();
+    }
+}
+
+/**
+ * @brief Compares two possibly-NULL strings.
+ */
+static int fuzz_same(const char *const a, const char *const b)
+{
+    return (!a && !b) || (a && b && strcmp(a, b) == 0);
+}
+
+// ============= ENTRY POINT =============
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (size >= FLUENT_LIBC_PATH_MAX)
+    {
+        return 0; // Keep realpath's work bounded
+    }
+
+    // Two NUL-terminated paths: data up to the first NUL, and the rest
+    char input[FLUENT_LIBC_PATH_MAX + 1];
+    memcpy(input, data, size);
+    input[size] = '\0';
+    const char *first = input;
+    const size_t first_len = strlen(first);
+    const char *second = first_len < size ? input + first_len + 1 : "";
+
+    // get_file_name vs get_file_name_slice vs path_file_name_view
+    char *name = get_file_name(first);
+    char *name_slice = get_file_name_slice(path_slice_from(first, first_len));
+    fuzz_check(fuzz_same(name, name_slice), "get_file_name == get_file_name_slice");
+    if (name)
+    {
+        const path_slice_t view = path_file_name_view(path_slice(first));
+        fuzz_check(view.len == strlen(name) && memcmp(view.ptr, name, view.len) == 0, "path_file_name_view");
+        fuzz_check(!strchr(name, PATH_SEPARATOR), "file name has no separator");
+    }
+    free(name);
+    free(name_slice);
+
+    // get_real_path family vs realpath(3)
+    char *real = get_real_path(first);
+    char *expected = first_len ? realpath(first, NULL) : NULL;
+    fuzz_check(fuzz_same(real, expected), "get_real_path == realpath");
+
+    size_t real_len = 0;
+    char *real_slice = get_real_path_slice(path_slice_from(first, first_len), &real_len);
+    fuzz_check(fuzz_same(real, real_slice), "get_real_path == get_real_path_slice");
+    fuzz_check(!real_slice || real_len == strlen(real_slice), "get_real_path_slice length");
+
+    char buffer[FLUENT_LIBC_PATH_MAX];
+    size_t buffer_len = 0;
+    const int resolved = get_real_path_buff(first, buffer);
+    fuzz_check(resolved == (real != NULL), "get_real_path_buff agrees with get_real_path");
+    fuzz_check(!resolved || strcmp(buffer, real) == 0, "get_real_path_buff result");
+    const int resolved_slice = get_real_path_buff_slice(path_slice_from(first, first_len), buffer, &buffer_len);
+    fuzz_check(resolved_slice == resolved, "get_real_path_buff_slice agrees");
+    fuzz_check(!resolved_slice || buffer_len == strlen(real), "get_real_path_buff_slice length");
+
+    free(real);
+    free(expected);
+    free(real_slice);
+
+    // path_join vs realpath(first/second)
+    char *joined = path_join(first, second);
+    size_t joined_len = 0;
+    char *joined_slice = path_join_slice(path_slice(first), path_slice(second), &joined_len);
+    fuzz_check(fuzz_same(joined, joined_slice), "path_join == path_join_slice");
+    if (first[0] && second[0] && first_len + 1 + strlen(second) < FLUENT_LIBC_PATH_MAX)
+    {
+        char concatenated[FLUENT_LIBC_PATH_MAX * 2 + 2];
+        snprintf(concatenated, sizeof(concatenated), "%s%c%s", first, PATH_SEPARATOR, second);
+        char *expected_join = realpath(concatenated, NULL);
+        fuzz_check(fuzz_same(joined, expected_join), "path_join == realpath(a/b)");
+        free(expected_join);
+    }
+    free(joined);
+    free(joined_slice);
+
+    // get_cwd is stable across calls
+    fuzz_check(get_cwd() == get_cwd(), "get_cwd is cached");
+    return 0;
+}
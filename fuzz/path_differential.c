@@ -0,0 +1,586 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+// ============= FLUENT LIB C =============
+// Differential harness against realpath(3)
+// ----------------------------------------
+// Builds random directory/symlink trees in a tmpfs and checks the library
+// against glibc on every one of them:
+//   - get_real_path / get_real_path_buff / the slice variants == realpath(3)
+//   - path_join(a, b) == realpath("a/b")
+//   - lexical fast paths (path_sanitize_into, path_hash) == realpath when no
+//     symbolic link is involved
+//   - path_walk reports every entry exactly once, under its real path, and
+//     path_walk_parallel reports the same set
+// and runs fixed regression cases once (link cycles under PATH_WALK_FOLLOW_LINKS,
+// stars inside glob bracket classes == fnmatch(3)).
+//
+// Usage:
+//   path_differential [trees] [seed]
+//
+// Exits with status 1 and prints the first mismatches if the library disagrees.
+//
+
+#ifndef _GNU_SOURCE
+#   define _GNU_SOURCE // For mkdtemp and nftw
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_arena.h"
+#include "path_glob.h"
+#include "path_hash.h"
+#include "path_sanitize.h"
+#include "path_walk.h"
+#include "path_walk_parallel.h"
+#include <errno.h>
+#include <fnmatch.h>
+#include <ftw.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ============= MACROS =============
+#define DIFF_NODES 48        // Entries created per tree
+#define DIFF_QUERIES 400     // Random paths resolved per tree
+#define DIFF_MAX_REPORTS 20  // Mismatches printed before going quiet
+
+// ============= GLOBALS =============
+static char diff_base[FLUENT_LIBC_PATH_MAX];      // Real path of the tree root
+static char *diff_nodes[DIFF_NODES + 1];          // Paths relative to diff_base ("" is the root)
+static int diff_is_dir[DIFF_NODES + 1];
+static size_t diff_count;
+static uint64_t diff_rng;
+static size_t diff_failures;
+static size_t diff_checks;
+
+// ============= HELPERS =============
+/**
+ * @brief Returns the next pseudo-random number (xorshift64*).
+ */
+static uint64_t diff_rand(void)
+{
+    diff_rng ^= diff_rng >> 12;
+    diff_rng ^= diff_rng << 25;
+    diff_rng ^= diff_rng >> 27;
+    return diff_rng * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief Records a check and prints it if it failed.
+ */
+static void diff_expect(const int ok, const char *const what, const char *const input, const char *const got, const char *const want)
+{
+    diff_checks++;
+    if (ok)
+    {
+        return;
+    }
+
+    if (diff_failures++ < DIFF_MAX_REPORTS)
+    {
+        fprintf(stderr, "MISMATCH %s\n  input: %s\n  got:   %s\n  want:  %s\n", what, input, got ? got : "(null)", want ? want : "(null)");
+    }
+}
+
+/**
+ * @brief Compares two possibly-NULL strings.
+ */
+static int diff_same(const char *const a, const char *const b)
+{
+    return (!a && !b) || (a && b && strcmp(a, b) == 0);
+}
+
+/**
+ * @brief Builds a relative symlink target from directory `from` to node `to` (both relative to the base).
+ */
+static void diff_relative(const char *const from, const char *const to, char *const out, const size_t cap)
+{
+    // Length of the common directory prefix
+    size_t common = 0;
+    for (size_t i = 0; from[i] && from[i] == to[i]; i++)
+    {
+        if (to[i + 1] == '/' && (from[i + 1] == '/' || from[i + 1] == '\0'))
+        {
+            common = i + 2;
+        }
+    }
+    if (!from[0])
+    {
+        common = 0;
+    }
+
+    // One ".." per remaining component of from
+    size_t len = 0;
+    out[0] = '\0';
+    for (const char *p = from + (common > strlen(from) ? strlen(from) : common); *p; )
+    {
+        len += (size_t)snprintf(out + len, cap - len, "../");
+        const char *slash = strchr(p, '/');
+        p = slash ? slash + 1 : p + strlen(p);
+    }
+
+    snprintf(out + len, cap - len, "%s", to[0] ? to + (common > strlen(to) ? strlen(to) : common) : ".");
+}
+
+/**
+ * @brief Removes a tree (nftw callback).
+ */
+static int diff_remove(const char *const path, const struct stat *const st, const int flag, struct FTW *const ftw)
+{
+    (void)st;
+    (void)flag;
+    (void)ftw;
+    return remove(path);
+}
+
+/**
+ * @brief Creates a random tree of directories, files and symbolic links under diff_base.
+ */
+static void diff_build_tree(void)
+{
+    diff_count = 0;
+    diff_nodes[diff_count] = strdup("");
+    diff_is_dir[diff_count++] = 1;
+
+    for (size_t i = 0; i < DIFF_NODES; i++)
+    {
+        // Pick a parent directory
+        size_t parent;
+        do
+        {
+            parent = (size_t)(diff_rand() % diff_count);
+        } while (!diff_is_dir[parent]);
+
+        char relative[FLUENT_LIBC_PATH_MAX];
+        char absolute[FLUENT_LIBC_PATH_MAX * 2];
+        snprintf(relative, sizeof(relative), "%s%sn%zu", diff_nodes[parent], diff_nodes[parent][0] ? "/" : "", i);
+        snprintf(absolute, sizeof(absolute), "%s/%s", diff_base, relative);
+
+        const unsigned kind = (unsigned)(diff_rand() % 100);
+        int is_dir = 0;
+        if (kind < 40)
+        {
+            if (mkdir(absolute, 0755) != 0)
+            {
+                continue;
+            }
+            is_dir = 1;
+        }
+        else if (kind < 70)
+        {
+            FILE *file = fopen(absolute, "w");
+            if (file)
+            {
+                fclose(file);
+            }
+        }
+        else
+        {
+            // Symbolic link: relative or absolute, to a node, to nothing, or to itself
+            char target[FLUENT_LIBC_PATH_MAX * 2];
+            const size_t to = (size_t)(diff_rand() % diff_count);
+            const unsigned style = (unsigned)(diff_rand() % 5);
+            if (style == 0)
+            {
+                snprintf(target, sizeof(target), "%s/%s", diff_base, diff_nodes[to]);
+            }
+            else if (style == 1)
+            {
+                snprintf(target, sizeof(target), "missing%zu", i);
+            }
+            else if (style == 2)
+            {
+                snprintf(target, sizeof(target), "n%zu", i); // Loop
+            }
+            else
+            {
+                diff_relative(diff_nodes[parent], diff_nodes[to], target, sizeof(target));
+            }
+
+            // Links are never used as parents, so every node has exactly one physical path
+            if (symlink(target, absolute) != 0)
+            {
+                continue;
+            }
+        }
+
+        diff_nodes[diff_count] = strdup(relative);
+        diff_is_dir[diff_count++] = is_dir;
+    }
+}
+
+/**
+ * @brief Builds a random query path out of tree names, ".", "..", empty and missing components.
+ */
+static void diff_random_query(char *const out, const size_t cap)
+{
+    size_t len = 0;
+    const int absolute = (int)(diff_rand() % 2);
+    out[0] = '\0';
+    if (absolute)
+    {
+        len += (size_t)snprintf(out, cap, "%s", diff_base);
+    }
+
+    const size_t components = 1 + (size_t)(diff_rand() % 6);
+    for (size_t i = 0; i < components && len < cap - 64; i++)
+    {
+        const unsigned kind = (unsigned)(diff_rand() % 10);
+        const char *component;
+        char name[32];
+        if (kind < 5)
+        {
+            // The last component of a random node
+            const char *node = diff_nodes[1 + diff_rand() % (diff_count - 1)];
+            const char *slash = strrchr(node, '/');
+            component = slash ? slash + 1 : node;
+        }
+        else if (kind < 7)
+        {
+            component = "..";
+        }
+        else if (kind < 8)
+        {
+            component = ".";
+        }
+        else if (kind < 9)
+        {
+            component = ""; // Doubled separator
+        }
+        else
+        {
+            snprintf(name, sizeof(name), "missing%u", (unsigned)(diff_rand() % 4));
+            component = name;
+        }
+
+        len += (size_t)snprintf(out + len, cap - len, "%s%s", len || absolute ? "/" : "", component);
+    }
+
+    if (len == 0)
+    {
+        snprintf(out, cap, ".");
+    }
+    else if (diff_rand() % 8 == 0)
+    {
+        snprintf(out + len, cap - len, "/"); // Trailing separator
+    }
+}
+
+/**
+ * @brief Checks whether any prefix of the raw query names a symbolic link.
+ */
+static int diff_crosses_link(const char *const query)
+{
+    char prefix[FLUENT_LIBC_PATH_MAX];
+    const size_t len = strlen(query);
+    for (size_t i = 1; i <= len; i++)
+    {
+        if (i == len || query[i] == '/')
+        {
+            memcpy(prefix, query, i);
+            prefix[i] = '\0';
+            struct stat st;
+            if (lstat(prefix, &st) == 0 && S_ISLNK(st.st_mode))
+            {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Compares the resolvers on one query.
+ */
+static void diff_query(const char *const query)
+{
+    char *want = realpath(query, NULL);
+
+    char *got = get_real_path(query);
+    diff_expect(diff_same(got, want), "get_real_path", query, got, want);
+
+    char buffer[FLUENT_LIBC_PATH_MAX];
+    const int resolved = get_real_path_buff(query, buffer);
+    diff_expect(resolved == (want != NULL) && (!resolved || strcmp(buffer, want) == 0), "get_real_path_buff", query, resolved ? buffer : NULL, want);
+
+    size_t len = 0;
+    char *got_slice = get_real_path_slice(path_slice(query), &len);
+    diff_expect(diff_same(got_slice, want) && (!got_slice || len == strlen(got_slice)), "get_real_path_slice", query, got_slice, want);
+
+    // Lexical fast paths agree with realpath when no symbolic link is involved
+    if (want && query[0] == '/' && !diff_crosses_link(query))
+    {
+        char clean[FLUENT_LIBC_PATH_MAX];
+        const int ok = path_sanitize_into(query, clean, sizeof(clean), 0, NULL);
+        diff_expect(ok && strcmp(clean, want) == 0, "path_sanitize_into (no links)", query, ok ? clean : NULL, want);
+        diff_expect(path_hash(query) == path_hash(want), "path_hash (no links)", query, NULL, want);
+    }
+
+    free(want);
+    free(got);
+    free(got_slice);
+}
+
+/**
+ * @brief Compares path_join against realpath of the concatenation.
+ */
+static void diff_join(const char *const a, const char *const b)
+{
+    char concatenated[FLUENT_LIBC_PATH_MAX * 2];
+    snprintf(concatenated, sizeof(concatenated), "%s/%s", a, b);
+    char *want = a[0] && b[0] ? realpath(concatenated, NULL) : NULL; // Empty parts are rejected
+    char *got = path_join(a, b);
+    diff_expect(diff_same(got, want), "path_join", concatenated, got, want);
+    free(want);
+    free(got);
+}
+
+// ============= WALK CHECKS =============
+/**
+ * @brief Collected walk output.
+ */
+typedef struct
+{
+    char **paths;
+    size_t count;
+    size_t cap;
+    pthread_mutex_t lock;
+} diff_walk_t;
+
+/**
+ * @brief Walk callback: records the entry and checks its path is real.
+ */
+static int diff_walk_visit(const path_walk_entry_t *const entry, void *const user_data)
+{
+    diff_walk_t *walk = (diff_walk_t *)user_data;
+    pthread_mutex_lock(&walk->lock);
+    if (walk->count == walk->cap)
+    {
+        walk->cap = walk->cap ? walk->cap * 2 : 64;
+        walk->paths = (char **)realloc(walk->paths, walk->cap * sizeof(char *));
+    }
+    walk->paths[walk->count++] = strdup(entry->path);
+    pthread_mutex_unlock(&walk->lock);
+
+    // Without following links, every reported path is already canonical up to its last component
+    if (entry->type != PATH_WALK_TYPE_LNK)
+    {
+        char *real = realpath(entry->path, NULL);
+        diff_expect(diff_same(real, entry->path), "path_walk entry is canonical", entry->path, entry->path, real);
+        free(real);
+    }
+
+    return PATH_WALK_CONTINUE;
+}
+
+/**
+ * @brief Orders strings for qsort.
+ */
+static int diff_order(const void *const a, const void *const b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/**
+ * @brief Releases collected walk output.
+ */
+static void diff_walk_free(diff_walk_t *const walk)
+{
+    for (size_t i = 0; i < walk->count; i++)
+    {
+        free(walk->paths[i]);
+    }
+    free(walk->paths);
+    pthread_mutex_destroy(&walk->lock);
+}
+
+/**
+ * @brief Checks path_walk and path_walk_parallel against the created tree.
+ */
+static void diff_walks(void)
+{
+    diff_walk_t serial = { NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER };
+    diff_walk_t parallel = { NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER };
+    diff_expect(path_walk(diff_base, 0, diff_walk_visit, &serial), "path_walk succeeds", diff_base, NULL, NULL);
+    diff_expect(path_walk_parallel(diff_base, 0, 4, diff_walk_visit, &parallel), "path_walk_parallel succeeds", diff_base, NULL, NULL);
+
+    // Every created node is reported exactly once
+    diff_expect(serial.count == diff_count - 1, "path_walk entry count", diff_base, NULL, NULL);
+    qsort(serial.paths, serial.count, sizeof(char *), diff_order);
+    qsort(parallel.paths, parallel.count, sizeof(char *), diff_order);
+    int same = serial.count == parallel.count;
+    for (size_t i = 0; same && i < serial.count; i++)
+    {
+        same = strcmp(serial.paths[i], parallel.paths[i]) == 0;
+    }
+    diff_expect(same, "path_walk_parallel reports the same entries as path_walk", diff_base, NULL, NULL);
+
+    diff_walk_free(&serial);
+    diff_walk_free(&parallel);
+}
+
+// ============= REGRESSIONS =============
+/**
+ * @brief Walk callback: counts entries.
+ */
+static int diff_count_visit(const path_walk_entry_t *const entry, void *const user_data)
+{
+    (void)entry;
+    __atomic_fetch_add((size_t *)user_data, 1, __ATOMIC_RELAXED);
+    return PATH_WALK_CONTINUE;
+}
+
+/**
+ * @brief Link cycles under PATH_WALK_FOLLOW_LINKS are reported once and never descended.
+ */
+static void diff_link_cycles(void)
+{
+    // cycle/a/up -> .. and cycle/a/self -> . loop back; cycle/b -> a is a plain alias of a
+    char root[FLUENT_LIBC_PATH_MAX + 8];  // diff_base + "/cycle"
+    char path[FLUENT_LIBC_PATH_MAX + 16]; // root + "/a/self"
+    snprintf(root, sizeof(root), "%s/cycle", diff_base);
+    snprintf(path, sizeof(path), "%s/a", root);
+    if (mkdir(root, 0755) != 0 || mkdir(path, 0755) != 0)
+    {
+        perror("path_differential: cycle tree");
+        return;
+    }
+    snprintf(path, sizeof(path), "%s/a/up", root);
+    symlink("..", path);
+    snprintf(path, sizeof(path), "%s/a/self", root);
+    symlink(".", path);
+    snprintf(path, sizeof(path), "%s/b", root);
+    symlink("a", path);
+
+    // a, a/up, a/self, b, b/up, b/self
+    size_t count = 0;
+    const int ok = path_walk(root, PATH_WALK_FOLLOW_LINKS, diff_count_visit, &count);
+    diff_expect(ok && count == 6, "path_walk stops at link cycles", root, NULL, NULL);
+
+    // The parallel walk reads each directory once: a (or b), then its up and self
+    count = 0;
+    const int parallel_ok = path_walk_parallel(root, PATH_WALK_FOLLOW_LINKS, 4, diff_count_visit, &count);
+    diff_expect(parallel_ok && count == 4, "path_walk_parallel stops at link cycles", root, NULL, NULL);
+
+    nftw(root, diff_remove, 16, FTW_DEPTH | FTW_PHYS);
+}
+
+/**
+ * @brief A '*' inside a bracket class is a member, never the component's last star.
+ */
+static void diff_glob_classes(void)
+{
+    static const char *const cases[][2] = {
+        { "[!*]", "b" },
+        { "[*]x", "*x" },
+        { "a[*]b", "a*b" },
+        { "[?*]", "?" },
+        { "*[!*]", "b" },
+        { "*[*]", "a*" },
+        { "*[]*]x", "a]x" },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        path_glob_t glob;
+        const char *const pattern = cases[i][0];
+        if (!path_glob_compile(&glob, &pattern, 1))
+        {
+            perror("path_differential: path_glob_compile");
+            return;
+        }
+
+        const int got = path_glob_match(&glob, cases[i][1], 0);
+        const int want = fnmatch(pattern, cases[i][1], 0) == 0;
+        diff_expect(got == want, "path_glob_match == fnmatch", pattern, got ? "match" : "no match", want ? "match" : "no match");
+        path_glob_destroy(&glob);
+    }
+}
+
+/**
+ * @brief A chunk sized for an oversized request still bounds the next allocation.
+ */
+static void diff_arena_chunks(void)
+{
+    // The oversized chunk loses its alignment padding; it must still count as
+    // full rather than leaving used past cap, where the next size check wraps
+    path_arena_t arena = {0};
+    const int big = path_arena_alloc(&arena, PATH_ARENA_CHUNK_SIZE + 1000) != NULL && arena.head->used <= arena.head->cap;
+    const int small = path_arena_alloc(&arena, 64) != NULL && arena.head->used <= arena.head->cap;
+    diff_expect(big && small, "path_arena_alloc stays inside its chunk", "oversized then 64 bytes", NULL, NULL);
+
+    path_arena_destroy(&arena);
+}
+
+// ============= ENTRY POINT =============
+int main(const int argc, char **argv)
+{
+    const unsigned long trees = argc > 1 ? strtoul(argv[1], NULL, 10) : 50;
+    diff_rng = argc > 2 ? strtoull(argv[2], NULL, 10) : 0x9E3779B97F4A7C15ULL;
+    if (diff_rng == 0)
+    {
+        diff_rng = 1;
+    }
+
+    // Prefer a tmpfs so the trees never touch a disk
+    char scratch[FLUENT_LIBC_PATH_MAX];
+    const char *tmp = access("/dev/shm", W_OK) == 0 ? "/dev/shm" : (getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp");
+    snprintf(scratch, sizeof(scratch), "%s/path_differential.XXXXXX", tmp);
+    if (!mkdtemp(scratch) || !realpath(scratch, diff_base) || chdir(diff_base) != 0)
+    {
+        perror("path_differential: scratch directory");
+        return 2;
+    }
+
+    diff_link_cycles();
+    diff_glob_classes();
+    diff_arena_chunks();
+
+    for (unsigned long tree = 0; tree < trees; tree++)
+    {
+        diff_build_tree();
+
+        char query[FLUENT_LIBC_PATH_MAX];
+        char other[FLUENT_LIBC_PATH_MAX];
+        for (size_t i = 0; i < DIFF_QUERIES; i++)
+        {
+            diff_random_query(query, sizeof(query));
+            diff_query(query);
+
+            diff_random_query(other, sizeof(other));
+            diff_join(query, other[0] == '/' ? other + strlen(diff_base) + 1 : other);
+        }
+
+        diff_walks();
+
+        // Start the next tree from an empty root
+        for (size_t i = 0; i < diff_count; i++)
+        {
+            free(diff_nodes[i]);
+        }
+        if (chdir("/") != 0 || nftw(diff_base, diff_remove, 16, FTW_DEPTH | FTW_PHYS) != 0 ||
+            mkdir(diff_base, 0700) != 0 || chdir(diff_base) != 0)
+        {
+            perror("path_differential: reset");
+            return 2;
+        }
+    }
+
+    chdir("/");
+    rmdir(diff_base);
+    printf("%zu checks, %zu mismatches\n", diff_checks, diff_failures);
+    return diff_failures ? 1 : 0;
+}
@@ -8,4 +8,32 @@
  * under certain conditions; type show c' for details.
 */
 
+// This translation unit holds the single definition of every function and global
+#ifndef FLUENT_LIBC_PATH_IMPLEMENTATION
+#   define FLUENT_LIBC_PATH_IMPLEMENTATION
+#endif
+
+#ifndef _GNU_SOURCE
+#   define _GNU_SOURCE // For O_PATH and AT_EMPTY_PATH
+#endif
+
 #include "path.h"
+#include "path_arena.h"
+#include "path_atomic.h"
+#include "path_pool.h"
+#include "path_walk.h"
+#include "path_walk_parallel.h"
+#include "path_glob.h"
+#include "path_glob_expand.h"
+#include "path_ext.h"
+#include "path_hash.h"
+#include "path_compare.h"
+#include "path_sanitize.h"
+#include "path_builder.h"
+#include "path_resolve.h"
+#include "path_probe.h"
+#include "path_identity.h"
+#include "path_mkdirs.h"
+#include "path_remove.h"
+#include "path_tree_stats.h"
+#include "path_snapshot.h"
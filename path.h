@@ -19,6 +19,11 @@
 //   - get_real_path(path)            – Returns a newly allocated, absolute canonical path
 //   - get_real_path(path, buffer, n) – Writes the resolved path into a user buffer
 //   - path_join(path1, path2)        – Concatenates two paths and returns a normalized absolute path
+//   - path_join_n(parts, n, flags)   – Joins n parts with one exact-size allocation, optionally
+//                                      resolving once at the end (PATH_JOIN(flags, ...) in C)
+//   - path_join_n_into(...)          – Same, into a caller buffer
+//   - *_slice variants               – Same operations on path_slice_t (pointer + length) inputs,
+//                                      so chained operations never rescan for the terminator
 //
 // Behavior:
 //   - On POSIX: uses realpath(3) to resolve symlinks and “.”/“..” components.
@@ -32,7 +37,24 @@
 // Dependencies:
 //   - POSIX: <unistd.h> & realpath
 //   - Windows: <windows.h> & GetFullPathNameA
-//   - Fluent Lib C: string_builder.h for efficient string concatenation in path_join
+//   - Fluent Lib C: string_builder.h for building the string returned by get_file_name,
+//     unless FLUENT_LIBC_PATH_NO_STRING_BUILDER is defined (the name is then copied
+//     into an exact-size malloc'd buffer and no other library is needed)
+//
+// Linkage:
+//   - By default every function is `static inline`: the headers work on their
+//     own, but each translation unit gets its own copy of the code and its own
+//     cwd cache.
+//   - FLUENT_LIBC_PATH_IMPLEMENTATION (stb-style, defined by path.c): the
+//     functions and globals are emitted once, with external linkage, into the
+//     translation unit that defines it (libpath.a).
+//   - FLUENT_LIBC_PATH_INLINE (set for consumers of the CMake `path` target):
+//     the bodies stay visible for inlining (and LTO), but out-of-line calls
+//     and the globals resolve to the single definitions in libpath.a, so all
+//     translation units share one cwd cache.
+//   - FLUENT_LIBC_PATH_DISPATCH (CMake option PATH_DISPATCH): the hot scanning
+//     loops (hashing, comparison, sanitization) are compiled for several CPU
+//     levels in libpath.a and the best one is picked at load time.
 //
 // Example:
 // ----------------------------------------
@@ -47,6 +69,13 @@
 //   char *joined = path_join("dir/sub", "file.txt");
 //   if (joined) { printf("Joined: %s\n", joined); free(joined); }
 //
+//   char *five = PATH_JOIN(0, root, "usr", "share", pkg, "config.toml"); // one malloc, no realpath
+//   if (five) { puts(five); free(five); }
+//
+//   size_t len;
+//   char *abs = path_join_slice(path_slice("dir"), path_slice_from(name, name_len), &len);
+//   path_slice_t base = path_file_name_view(path_slice_from(abs, len)); // no copy, no rescan
+//
 
 // ============= FLUENT LIB C++ =============
 #if defined(__cplusplus)
@@ -66,15 +95,97 @@ extern "C"
 #       define PATH_SEPARATOR '\\'
 #   endif
 #endif
-#ifndef FLUENT_LIBC_RELEASE
-#   include <string_builder.h> // fluent_libc
+#include <limits.h> // For PATH_MAX
+#include <stdlib.h> // For realpath and free
+#include <string.h> // For memcpy and strlen
+#if (!defined(FLUENT_LIBC_PATH_INLINE) || defined(FLUENT_LIBC_PATH_IMPLEMENTATION)) && !defined(FLUENT_LIBC_PATH_NO_STRING_BUILDER)
+#   ifndef FLUENT_LIBC_RELEASE
+#       include <string_builder.h> // fluent_libc
+#   else
+#       include <fluent/string_builder/string_builder.h> // fluent_libc
+#   endif
+#endif
+
+// ============= MACROS =============
+#if defined(FLUENT_LIBC_PATH_IMPLEMENTATION)
+#   define FLUENT_LIBC_PATH_API // External definitions, emitted once
+#   define FLUENT_LIBC_PATH_DATA
+#elif defined(FLUENT_LIBC_PATH_INLINE)
+#   if defined(__GNUC__) || defined(__clang__)
+#       define FLUENT_LIBC_PATH_API extern inline __attribute__((gnu_inline)) // Inline body, no local copy
+#   else
+#       define FLUENT_LIBC_PATH_API inline // C99 inline definition
+#   endif
+#   define FLUENT_LIBC_PATH_DATA extern
+#else
+#   define FLUENT_LIBC_PATH_API static inline // Header-only: one copy per translation unit
+#   define FLUENT_LIBC_PATH_DATA static
+#endif
+
+// Runtime CPU dispatch of the hot scanning loops (x86-64 Linux, GCC or Clang 14+)
+#if defined(FLUENT_LIBC_PATH_DISPATCH) && defined(__x86_64__) && defined(__linux__) && \
+    ((defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 6) || (defined(__clang_major__) && __clang_major__ >= 14))
+#   if defined(FLUENT_LIBC_PATH_IMPLEMENTATION)
+#       define FLUENT_LIBC_PATH_HOT __attribute__((target_clones("default", "sse4.2", "avx2"))) // Resolved at load time
+#   else
+#       define FLUENT_LIBC_PATH_HOT
+#       ifdef FLUENT_LIBC_PATH_INLINE
+#           define __FLUENT_LIBC_PATH_HOT_EXTERN // Hot functions are only declared: calls reach the dispatched copies
+#       endif
+#   endif
+#else
+#   define FLUENT_LIBC_PATH_HOT
+#endif
+
+#ifndef PATH_JOIN_INLINE_PARTS
+#   define PATH_JOIN_INLINE_PARTS 16 // path_join_n parts measured on the stack before falling back to malloc
+#endif
+
+#ifndef __cplusplus
+/**
+ * @brief Joins its arguments with path_join_n(): PATH_JOIN(flags, "a", b, "c").
+ */
+#   define PATH_JOIN(flags, ...) \
+        path_join_n((const char *const[]){ __VA_ARGS__ }, \
+                    sizeof((const char *const[]){ __VA_ARGS__ }) / sizeof(const char *), (flags))
+#endif
+
+#ifdef PATH_MAX
+#   define FLUENT_LIBC_PATH_MAX PATH_MAX
 #else
-#   include <fluent/string_builder/string_builder.h> // fluent_libc
+#   define FLUENT_LIBC_PATH_MAX 4096
 #endif
 
+// ============= TYPES =============
+/**
+ * @brief A read-only view of a path: a pointer and a known length.
+ *
+ * The bytes do not need to be NUL-terminated. Passing slices between path
+ * operations lets every function skip the strlen-style rescans of its input.
+ */
+typedef struct
+{
+    const char *ptr; // First byte of the path
+    size_t len;      // Number of bytes in the path
+} path_slice_t;
+
+/**
+ * @brief Options for path_join_n().
+ */
+typedef enum
+{
+    PATH_JOIN_RESOLVE = 1 << 0,         // Canonicalize the joined path once, like path_join()
+    PATH_JOIN_ABSOLUTE_RESETS = 1 << 1, // A part starting with a separator discards the parts before it
+} path_join_flags_t;
+
 // ============= GLOBALS =============
-static char __fluent_libc_path_cwd[256];
-static int __fluent_libc_path_cwd_initialized = 0;
+#if defined(FLUENT_LIBC_PATH_INLINE) && !defined(FLUENT_LIBC_PATH_IMPLEMENTATION)
+extern char __fluent_libc_path_cwd[256];
+extern int __fluent_libc_path_cwd_initialized;
+#else
+FLUENT_LIBC_PATH_DATA char __fluent_libc_path_cwd[256];
+FLUENT_LIBC_PATH_DATA int __fluent_libc_path_cwd_initialized = 0;
+#endif
 
 /**
  * @brief Returns the current working directory as a cached string.
@@ -89,7 +200,7 @@ static int __fluent_libc_path_cwd_initialized = 0;
  *         or NULL if the directory cannot be retrieved.
  *         The returned pointer must NOT be freed by the caller.
  */
-static inline char *get_cwd()
+FLUENT_LIBC_PATH_API char *get_cwd()
 {
     // If the current working directory is already cached, return it
     if (__fluent_libc_path_cwd_initialized)
@@ -123,6 +234,155 @@ static inline char *get_cwd()
     return __fluent_libc_path_cwd;
 }
 
+/**
+ * @brief Creates a slice over a NUL-terminated path. This is the only place the length is scanned.
+ *
+ * @param path The path, or NULL for an empty slice.
+ * @return A slice covering the whole path.
+ */
+FLUENT_LIBC_PATH_API path_slice_t path_slice(const char *const path)
+{
+    path_slice_t slice;
+    slice.ptr = path;
+    slice.len = path ? strlen(path) : 0;
+    return slice;
+}
+
+/**
+ * @brief Creates a slice from a pointer and a known length.
+ *
+ * @param ptr The first byte of the path.
+ * @param len The number of bytes.
+ * @return The slice.
+ */
+FLUENT_LIBC_PATH_API path_slice_t path_slice_from(const char *const ptr, const size_t len)
+{
+    path_slice_t slice;
+    slice.ptr = ptr;
+    slice.len = len;
+    return slice;
+}
+
+/**
+ * @brief Returns the file name component of a path as a view into the same bytes.
+ *
+ * Only the file name itself is scanned (backwards from the end of the slice).
+ * A path ending with a separator yields an empty slice.
+ *
+ * @param path The path.
+ * @return A slice covering the bytes after the last separator.
+ */
+FLUENT_LIBC_PATH_API path_slice_t path_file_name_view(const path_slice_t path)
+{
+    size_t start = path.len;
+    while (start > 0 && path.ptr[start - 1] != PATH_SEPARATOR)
+    {
+        start--;
+    }
+
+    return path_slice_from(path.ptr + start, path.len - start);
+}
+
+/**
+ * @brief Copies a slice into a NUL-terminated buffer of FLUENT_LIBC_PATH_MAX bytes.
+ *
+ * @return 1 on success, 0 if the slice is empty or does not fit.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_slice_terminate(const path_slice_t path, char *const buffer)
+{
+    if (!path.ptr || path.len == 0 || path.len >= FLUENT_LIBC_PATH_MAX)
+    {
+        return 0; // Invalid or too long
+    }
+
+    memcpy(buffer, path.ptr, path.len);
+    buffer[path.len] = '\0';
+    return 1;
+}
+
+/**
+ * @brief Copies a file name into a string builder reserved to its exact size.
+ *
+ * The name is appended with bulk writes: directly when it is already
+ * NUL-terminated, otherwise staged through a stack chunk. The builder is
+ * initialized with name.len + 1 bytes, so it never regrows.
+ *
+ * @param name The file name span.
+ * @param terminated Non-zero if name.ptr[name.len] is a NUL terminator.
+ * @return The collected name, to be freed by the caller.
+ */
+#if defined(FLUENT_LIBC_PATH_INLINE) && !defined(FLUENT_LIBC_PATH_IMPLEMENTATION)
+// string_builder's functions are static, so this one stays out of line in libpath.a
+char *__fluent_libc_path_collect_name(path_slice_t name, int terminated);
+#else
+FLUENT_LIBC_PATH_API char *__fluent_libc_path_collect_name(const path_slice_t name, const int terminated)
+{
+#ifdef FLUENT_LIBC_PATH_NO_STRING_BUILDER
+    // Exact-size copy, no dependency
+    char *copy = (char *)malloc(name.len + 1);
+    if (!copy)
+    {
+        return NULL; // Memory allocation failed
+    }
+
+    if (name.len)
+    {
+        memcpy(copy, name.ptr, name.len);
+    }
+    copy[name.len] = '\0';
+    (void)terminated;
+    return copy;
+#else
+    string_builder_t sb;
+    init_string_builder(&sb, name.len + 1, 1.5);
+
+    if (terminated)
+    {
+        write_string_builder(&sb, name.ptr); // One write for the whole span
+    }
+    else
+    {
+        // write_string_builder needs a terminator: stage the span in chunks
+        char chunk[256];
+        const char *ptr = name.ptr;
+        size_t left = name.len;
+        while (left > 0)
+        {
+            const size_t n = left < sizeof(chunk) - 1 ? left : sizeof(chunk) - 1;
+            memcpy(chunk, ptr, n);
+            chunk[n] = '\0';
+            write_string_builder(&sb, chunk);
+            ptr += n;
+            left -= n;
+        }
+    }
+
+    // Return the collected file name from the string builder
+    return collect_string_builder_no_copy(&sb);
+#endif
+}
+#endif
+
+/**
+ * @brief Extracts the file name component from a path slice.
+ *
+ * Behaves like get_file_name(), but only scans the file name itself.
+ *
+ * @param path The input path slice. Must not be empty.
+ * @return A newly allocated string containing the file name, or NULL on error.
+ */
+FLUENT_LIBC_PATH_API char *get_file_name_slice(const path_slice_t path)
+{
+    // Validate the input path
+    if (!path.ptr || path.len == 0)
+    {
+        return NULL; // Invalid path
+    }
+
+    // Locate the file name from the end instead of rebuilding every segment
+    return __fluent_libc_path_collect_name(path_file_name_view(path), 0);
+}
+
 /**
  * @brief Extracts the file name component from a given file system path.
  *
@@ -134,7 +394,7 @@ static inline char *get_cwd()
  * @param path The input file system path. Must not be NULL or empty.
  * @return A newly allocated string containing the file name, or NULL on error.
  */
-static inline char *get_file_name(const char *const path)
+FLUENT_LIBC_PATH_API char *get_file_name(const char *const path)
 {
     // Validate the input path
     if (!path || path[0] == '\0')
@@ -142,28 +402,8 @@ static inline char *get_file_name(const char *const path)
         return NULL; // Invalid path
     }
 
-    // Create a string builder to hold the file name
-    string_builder_t sb;
-    init_string_builder(&sb, 64, 1.5); // Initialize with a reasonable size
-
-    // Iterate over the path to find the last separator
-    for (size_t i = 0; path[i] != '\0'; i++)
-    {
-        // If we find a path separator, reset the string builder
-        if (path[i] == PATH_SEPARATOR)
-        {
-            // Reset the string builder to start fresh for the next segment
-            reset_string_builder(&sb);
-        }
-        else
-        {
-            // Append the character to the string builder
-            write_char_string_builder(&sb, path[i]);
-        }
-    }
-
-    // Return the collected file name from the string builder
-    return collect_string_builder_no_copy(&sb);
+    // The name is a suffix of path, so it is already NUL-terminated
+    return __fluent_libc_path_collect_name(path_file_name_view(path_slice(path)), 1);
 }
 
 /**
@@ -179,7 +419,7 @@ static inline char *get_file_name(const char *const path)
  *         or NULL if the input is invalid, the path cannot be resolved,
  *         or memory allocation fails. The caller is responsible for freeing the returned string.
  */
-static inline char *get_real_path(const char *const path)
+FLUENT_LIBC_PATH_API char *get_real_path(const char *const path)
 {
     // Validate the input path
     if (!path || path[0] == '\0')
@@ -232,7 +472,7 @@ static inline char *get_real_path(const char *const path)
  * @param buffer The buffer to store the resolved absolute path. Must not be NULL.
  * @return 1 if the path was resolved successfully, 0 otherwise.
  */
-static inline int get_real_path_buff(const char *const path, char *const buffer)
+FLUENT_LIBC_PATH_API int get_real_path_buff(const char *const path, char *const buffer)
 {
     // Validate the input path
     if (!path || path[0] == '\0')
@@ -260,6 +500,112 @@ static inline int get_real_path_buff(const char *const path, char *const buffer)
 #endif
 }
 
+/**
+ * @brief Resolves the absolute, canonicalized path for a path slice.
+ *
+ * Behaves like get_real_path(), and reports the length of the result so
+ * callers can keep working with slices.
+ *
+ * @param path The input path slice. Must not be empty.
+ * @param out_len Receives the length of the resolved path (may be NULL).
+ * @return A newly allocated string containing the resolved absolute path, or NULL on error.
+ *         The caller is responsible for freeing the returned string.
+ */
+FLUENT_LIBC_PATH_API char *get_real_path_slice(const path_slice_t path, size_t *const out_len)
+{
+    // realpath needs a terminated string; copy the known number of bytes
+    char terminated[FLUENT_LIBC_PATH_MAX];
+    if (!__fluent_libc_path_slice_terminate(path, terminated))
+    {
+        return NULL; // Invalid path
+    }
+
+    char *resolved_path = get_real_path(terminated);
+    if (resolved_path && out_len)
+    {
+        *out_len = strlen(resolved_path);
+    }
+
+    return resolved_path;
+}
+
+/**
+ * @brief Resolves the absolute, canonicalized path for a path slice into a user-provided buffer.
+ *
+ * @param path The input path slice. Must not be empty.
+ * @param buffer The buffer to store the resolved absolute path (at least FLUENT_LIBC_PATH_MAX bytes).
+ * @param out_len Receives the length of the resolved path (may be NULL).
+ * @return 1 if the path was resolved successfully, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int get_real_path_buff_slice(const path_slice_t path, char *const buffer, size_t *const out_len)
+{
+    // realpath needs a terminated string; copy the known number of bytes
+    char terminated[FLUENT_LIBC_PATH_MAX];
+    if (!__fluent_libc_path_slice_terminate(path, terminated))
+    {
+        return 0; // Invalid path
+    }
+
+    if (get_real_path_buff(terminated, buffer) != 1)
+    {
+        return 0; // Failed to resolve the path
+    }
+
+    if (out_len)
+    {
+        *out_len = strlen(buffer);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Joins two path slices and returns the normalized absolute path.
+ *
+ * Behaves like path_join(). Both inputs are copied with their known lengths,
+ * so neither is scanned for its terminator.
+ *
+ * @param path1 The first path component. Must not be empty.
+ * @param path2 The second path component. Must not be empty.
+ * @param out_len Receives the length of the resolved path (may be NULL).
+ * @return A newly allocated string containing the normalized absolute path, or NULL on error.
+ *         The caller is responsible for freeing the returned string.
+ */
+FLUENT_LIBC_PATH_API char *path_join_slice(const path_slice_t path1, const path_slice_t path2, size_t *const out_len)
+{
+#if defined(FLUENT_LIBC_NO_WINDOWS_SDK) && defined(_WIN32)
+    return NULL; // If Windows SDK is not included, we cannot join paths
+#endif
+
+    // Validate the input paths
+    if (!path1.ptr || !path2.ptr || path1.len == 0 || path2.len == 0)
+    {
+        return NULL; // Invalid paths
+    }
+
+    // Concatenate both paths with a separator in between
+    const size_t joined_len = path1.len + 1 + path2.len;
+    if (joined_len >= FLUENT_LIBC_PATH_MAX)
+    {
+        return NULL; // Too long to be resolved
+    }
+
+    char joined_path[FLUENT_LIBC_PATH_MAX];
+    memcpy(joined_path, path1.ptr, path1.len);
+    joined_path[path1.len] = PATH_SEPARATOR;
+    memcpy(joined_path + path1.len + 1, path2.ptr, path2.len);
+    joined_path[joined_len] = '\0';
+
+    // Normalize the path to remove any redundant separators
+    char *normalized_path = get_real_path(joined_path);
+    if (normalized_path && out_len)
+    {
+        *out_len = strlen(normalized_path);
+    }
+
+    return normalized_path;
+}
+
 /**
  * @brief Joins two file system paths and returns the normalized absolute path.
  *
@@ -273,36 +619,358 @@ static inline int get_real_path_buff(const char *const path, char *const buffer)
  *         or NULL if the input is invalid, the path cannot be resolved,
  *         or memory allocation fails. The caller is responsible for freeing the returned string.
  */
-static inline char *path_join(const char *const path1, const char *const path2)
+FLUENT_LIBC_PATH_API char *path_join(const char *const path1, const char *const path2)
 {
-#if defined(FLUENT_LIBC_NO_WINDOWS_SDK) && defined(_WIN32)
-    return NULL; // If Windows SDK is not included, we cannot join paths
-#endif
+    return path_join_slice(path_slice(path1), path_slice(path2), NULL);
+}
 
-    // Validate the input paths
-    if (!path1 || !path2 || path1[0] == '\0' || path2[0] == '\0')
+/**
+ * @brief Writes the lexical join of n parts, snprintf-style.
+ *
+ * Empty parts are skipped. A separator is inserted between two parts only
+ * when neither side already has one, and doubled separators at a boundary
+ * are collapsed. Nothing else is normalized.
+ *
+ * @param parts The parts to join.
+ * @param n The number of parts.
+ * @param flags A combination of path_join_flags_t values (only PATH_JOIN_ABSOLUTE_RESETS is used).
+ * @param out The destination, or NULL to only measure.
+ * @param cap The capacity of out.
+ * @return The length of the full join (which may exceed cap).
+ */
+FLUENT_LIBC_PATH_API size_t __fluent_libc_path_join_n_write(
+    const path_slice_t *const parts,
+    const size_t n,
+    const int flags,
+    char *const out,
+    const size_t cap
+)
+{
+    // Start at the last absolute part, if requested
+    size_t first = 0;
+    if (flags & PATH_JOIN_ABSOLUTE_RESETS)
     {
-        return NULL; // Invalid paths
+        for (size_t i = n; i > 0; i--)
+        {
+            if (parts[i - 1].len > 0 && parts[i - 1].ptr[0] == PATH_SEPARATOR)
+            {
+                first = i - 1;
+                break;
+            }
+        }
     }
 
-    // Use a string builder to construct the joined path
-    string_builder_t sb;
-    init_string_builder(&sb, 256, 1.5); // Initialize with a reasonable size
-    write_string_builder(&sb, path1); // Write the first path
-    write_char_string_builder(&sb, PATH_SEPARATOR); // Add the path separator
-    write_string_builder(&sb, path2); // Write the second path
+    size_t len = 0;
+    char last = '\0';
+    for (size_t i = first; i < n; i++)
+    {
+        const char *ptr = parts[i].ptr;
+        size_t part_len = parts[i].len;
 
-    // Collect the result from the string builder without copying
-    const char *joined_path = collect_string_builder_no_copy(&sb);
+        if (len > 0 && part_len > 0)
+        {
+            if (last == PATH_SEPARATOR)
+            {
+                // Already separated: drop the part's own leading separators
+                while (part_len > 0 && *ptr == PATH_SEPARATOR)
+                {
+                    ptr++;
+                    part_len--;
+                }
+            }
+            else if (*ptr != PATH_SEPARATOR)
+            {
+                if (len < cap)
+                {
+                    out[len] = PATH_SEPARATOR;
+                }
+                len++;
+                last = PATH_SEPARATOR;
+            }
+        }
 
-    // Normalize the path to remove any redundant separators
-    char *normalized_path = get_real_path(joined_path);
+        if (part_len == 0)
+        {
+            continue; // Empty part
+        }
 
-    // Free the string builder resources
-    destroy_string_builder(&sb);
+        if (len < cap)
+        {
+            memcpy(out + len, ptr, part_len < cap - len ? part_len : cap - len);
+        }
+        len += part_len;
+        last = ptr[part_len - 1];
+    }
 
-    // Return the normalized path
-    return normalized_path;
+    return len;
+}
+
+/**
+ * @brief Checks the parts of path_join_n_slice() and its variants.
+ *
+ * @return 1 if every part is usable, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_join_n_valid(const path_slice_t *const parts, const size_t n)
+{
+    if (!parts && n > 0)
+    {
+        return 0; // Invalid parts
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!parts[i].ptr && parts[i].len > 0)
+        {
+            return 0; // Invalid part
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Joins n path slices into a caller-provided buffer.
+ *
+ * Behaves like path_join_n_into().
+ *
+ * @param parts The parts to join.
+ * @param n The number of parts.
+ * @param flags A combination of path_join_flags_t values.
+ * @param buffer The destination buffer.
+ * @param cap The capacity of buffer, including the terminator.
+ * @param out_len Receives the length of the result (may be NULL).
+ * @return 1 on success, 0 if the parts are invalid or empty, the result does not fit,
+ *         or (with PATH_JOIN_RESOLVE) the path cannot be resolved.
+ */
+FLUENT_LIBC_PATH_API int path_join_n_into_slice(
+    const path_slice_t *const parts,
+    const size_t n,
+    const int flags,
+    char *const buffer,
+    const size_t cap,
+    size_t *const out_len
+)
+{
+    if (!buffer || cap == 0 || !__fluent_libc_path_join_n_valid(parts, n))
+    {
+        return 0; // Invalid arguments
+    }
+
+    if (!(flags & PATH_JOIN_RESOLVE))
+    {
+        // A single pass straight into the destination
+        const size_t len = __fluent_libc_path_join_n_write(parts, n, flags, buffer, cap);
+        if (len == 0 || len >= cap)
+        {
+            return 0; // Nothing to join, or too long
+        }
+
+        buffer[len] = '\0';
+        if (out_len)
+        {
+            *out_len = len;
+        }
+
+        return 1;
+    }
+
+    // Join on the stack, then resolve once
+    char joined[FLUENT_LIBC_PATH_MAX];
+    const size_t joined_len = __fluent_libc_path_join_n_write(parts, n, flags, joined, sizeof(joined));
+    if (joined_len == 0 || joined_len >= sizeof(joined))
+    {
+        return 0; // Nothing to join, or too long to be resolved
+    }
+    joined[joined_len] = '\0';
+
+    char resolved[FLUENT_LIBC_PATH_MAX];
+    if (!get_real_path_buff(joined, resolved))
+    {
+        return 0; // The path cannot be resolved
+    }
+
+    const size_t len = strlen(resolved);
+    if (len >= cap)
+    {
+        return 0; // Does not fit
+    }
+
+    memcpy(buffer, resolved, len + 1);
+    if (out_len)
+    {
+        *out_len = len;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Joins n path slices with a single allocation.
+ *
+ * Behaves like path_join_n().
+ *
+ * @param parts The parts to join.
+ * @param n The number of parts.
+ * @param flags A combination of path_join_flags_t values.
+ * @param out_len Receives the length of the result (may be NULL).
+ * @return A newly allocated string, or NULL on error. The caller must free it.
+ */
+FLUENT_LIBC_PATH_API char *path_join_n_slice(const path_slice_t *const parts, const size_t n, const int flags, size_t *const out_len)
+{
+    if (!__fluent_libc_path_join_n_valid(parts, n))
+    {
+        return NULL; // Invalid parts
+    }
+
+    if (flags & PATH_JOIN_RESOLVE)
+    {
+        // Join on the stack; realpath makes the only allocation
+        char joined[FLUENT_LIBC_PATH_MAX];
+        const size_t joined_len = __fluent_libc_path_join_n_write(parts, n, flags, joined, sizeof(joined));
+        if (joined_len == 0 || joined_len >= sizeof(joined))
+        {
+            return NULL; // Nothing to join, or too long to be resolved
+        }
+        joined[joined_len] = '\0';
+
+        char *resolved = get_real_path(joined);
+        if (resolved && out_len)
+        {
+            *out_len = strlen(resolved);
+        }
+
+        return resolved;
+    }
+
+    // Measure, allocate the exact size, write
+    const size_t len = __fluent_libc_path_join_n_write(parts, n, flags, NULL, 0);
+    if (len == 0)
+    {
+        return NULL; // Nothing to join
+    }
+
+    char *joined = (char *)malloc(len + 1);
+    if (!joined)
+    {
+        return NULL; // Memory allocation failed
+    }
+
+    __fluent_libc_path_join_n_write(parts, n, flags, joined, len + 1);
+    joined[len] = '\0';
+    if (out_len)
+    {
+        *out_len = len;
+    }
+
+    return joined;
+}
+
+/**
+ * @brief Measures NUL-terminated parts once into slices.
+ *
+ * @param parts The parts.
+ * @param n The number of parts.
+ * @param local A stack array of PATH_JOIN_INLINE_PARTS slices, used when n fits.
+ * @return local or a malloc'd array (free it if it is not local), or NULL if a part is NULL
+ *         or memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API path_slice_t *__fluent_libc_path_join_n_slices(const char *const *const parts, const size_t n, path_slice_t *const local)
+{
+    if (!parts && n > 0)
+    {
+        return NULL; // Invalid parts
+    }
+
+    path_slice_t *slices = n <= PATH_JOIN_INLINE_PARTS ? local : (path_slice_t *)malloc(n * sizeof(path_slice_t));
+    if (!slices)
+    {
+        return NULL; // Memory allocation failed
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!parts[i])
+        {
+            if (slices != local)
+            {
+                free(slices);
+            }
+            return NULL; // Invalid part
+        }
+
+        slices[i] = path_slice(parts[i]);
+    }
+
+    return slices;
+}
+
+/**
+ * @brief Joins n paths into a caller-provided buffer.
+ *
+ * @param parts The NUL-terminated parts to join. None may be NULL.
+ * @param n The number of parts.
+ * @param flags A combination of path_join_flags_t values.
+ * @param buffer The destination buffer.
+ * @param cap The capacity of buffer, including the terminator.
+ * @param out_len Receives the length of the result (may be NULL).
+ * @return 1 on success, 0 on error (see path_join_n_into_slice()).
+ */
+FLUENT_LIBC_PATH_API int path_join_n_into(
+    const char *const *const parts,
+    const size_t n,
+    const int flags,
+    char *const buffer,
+    const size_t cap,
+    size_t *const out_len
+)
+{
+    path_slice_t local[PATH_JOIN_INLINE_PARTS];
+    path_slice_t *slices = __fluent_libc_path_join_n_slices(parts, n, local);
+    if (!slices)
+    {
+        return 0; // Invalid parts or memory allocation failed
+    }
+
+    const int result = path_join_n_into_slice(slices, n, flags, buffer, cap, out_len);
+    if (slices != local)
+    {
+        free(slices);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Joins n paths with a single exact-size allocation.
+ *
+ * Replaces chains of path_join() calls: the lengths are summed, the result is
+ * allocated once, and separators are inserted only where a boundary lacks one
+ * (empty parts are skipped). The join is lexical unless PATH_JOIN_RESOLVE is
+ * given, in which case the joined path is canonicalized once at the end (and
+ * must exist), as path_join() does.
+ *
+ * @param parts The NUL-terminated parts to join. None may be NULL.
+ * @param n The number of parts.
+ * @param flags A combination of path_join_flags_t values.
+ * @return A newly allocated string, or NULL if the parts are invalid or all empty,
+ *         the path cannot be resolved, or memory allocation fails. The caller must free it.
+ */
+FLUENT_LIBC_PATH_API char *path_join_n(const char *const *const parts, const size_t n, const int flags)
+{
+    path_slice_t local[PATH_JOIN_INLINE_PARTS];
+    path_slice_t *slices = __fluent_libc_path_join_n_slices(parts, n, local);
+    if (!slices)
+    {
+        return NULL; // Invalid parts or memory allocation failed
+    }
+
+    char *joined = path_join_n_slice(slices, n, flags, NULL);
+    if (slices != local)
+    {
+        free(slices);
+    }
+
+    return joined;
 }
 
 // ============= FLUENT LIB C++ =============
@@ -0,0 +1,153 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_ARENA_LIBRARY_H
+#define FLUENT_LIBC_PATH_ARENA_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Path Arena
+// ----------------------------------------
+// Chunked bump allocator used to hand out many small path strings cheaply.
+// Provides:
+//   - path_arena_alloc(arena, size)           – Allocates 16-byte aligned memory
+//   - path_arena_strndup(arena, str, len)     – Copies a byte range as a C string
+//   - path_arena_destroy(arena)               – Releases every allocation at once
+//
+// Memory Management:
+//   - A zero-initialized path_arena_t is an empty arena.
+//   - Individual allocations are never freed; path_arena_destroy() releases them all.
+//   - An arena is not thread-safe; give each thread its own.
+//
+// Example:
+// ----------------------------------------
+//   path_arena_t arena = {0};
+//   char *copy = path_arena_strndup(&arena, "foo/bar", 7);
+//   path_arena_destroy(&arena);
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include <stdint.h> // For uintptr_t
+#include <stdlib.h>
+#include <string.h>
+
+// ============= MACROS =============
+#ifndef PATH_ARENA_CHUNK_SIZE
+#   define PATH_ARENA_CHUNK_SIZE (256 * 1024) // Size of an arena chunk
+#endif
+
+// ============= TYPES =============
+/**
+ * @brief A chunk of a bump allocator.
+ */
+typedef struct __fluent_libc_path_arena_chunk
+{
+    struct __fluent_libc_path_arena_chunk *next; // Previously filled chunk
+    size_t used;                                 // Bytes handed out from this chunk
+    size_t cap;                                  // Usable bytes in this chunk
+    char data[];                                 // Chunk memory
+} __fluent_libc_path_arena_chunk_t;
+
+/**
+ * @brief A per-thread bump allocator. Memory is released all at once.
+ */
+typedef struct
+{
+    __fluent_libc_path_arena_chunk_t *head; // Chunk currently being filled
+} path_arena_t;
+
+/**
+ * @brief Allocates memory from an arena.
+ *
+ * @param arena The arena to allocate from.
+ * @param size The number of bytes to allocate.
+ * @return A pointer aligned to 16 bytes, or NULL if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API void *path_arena_alloc(path_arena_t *const arena, size_t size)
+{
+    // Keep every allocation 16-byte aligned
+    size = (size + 15) & ~(size_t)15;
+
+    // Start a new chunk if the current one cannot hold the request
+    __fluent_libc_path_arena_chunk_t *chunk = arena->head;
+    if (!chunk || chunk->cap - chunk->used < size)
+    {
+        const size_t cap = size > PATH_ARENA_CHUNK_SIZE ? size : PATH_ARENA_CHUNK_SIZE;
+        chunk = (__fluent_libc_path_arena_chunk_t *)malloc(sizeof(__fluent_libc_path_arena_chunk_t) + cap + 15);
+        if (!chunk)
+        {
+            return NULL; // Memory allocation failed
+        }
+
+        // The alignment padding comes out of the 15 spare bytes, so count it
+        // as capacity; otherwise a request larger than cap - padding would
+        // leave used > cap and the next size check would wrap around
+        chunk->next = arena->head;
+        chunk->used = (size_t)(-(uintptr_t)chunk->data & 15); // Align the first allocation
+        chunk->cap = cap + chunk->used;
+        arena->head = chunk;
+    }
+
+    void *ptr = chunk->data + chunk->used;
+    chunk->used += size;
+    return ptr;
+}
+
+/**
+ * @brief Releases every chunk owned by an arena.
+ *
+ * @param arena The arena to destroy.
+ */
+FLUENT_LIBC_PATH_API void path_arena_destroy(path_arena_t *const arena)
+{
+    __fluent_libc_path_arena_chunk_t *chunk = arena->head;
+    while (chunk)
+    {
+        __fluent_libc_path_arena_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+
+    arena->head = NULL;
+}
+
+/**
+ * @brief Copies a byte range into an arena as a NUL-terminated string.
+ *
+ * @param arena The arena to allocate from.
+ * @param str The bytes to copy.
+ * @param len The number of bytes to copy.
+ * @return The copy, or NULL if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API char *path_arena_strndup(path_arena_t *const arena, const char *const str, const size_t len)
+{
+    char *copy = (char *)path_arena_alloc(arena, len + 1);
+    if (!copy)
+    {
+        return NULL; // Memory allocation failed
+    }
+
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_ARENA_LIBRARY_H
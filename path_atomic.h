@@ -0,0 +1,56 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_ATOMIC_LIBRARY_H
+#define FLUENT_LIBC_PATH_ATOMIC_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Atomic Operations (internal)
+// ----------------------------------------
+// Atomic access shared by the multi-threaded headers, usable from C and C++.
+// Provides:
+//   - __FLUENT_LIBC_PATH_ATOMIC_LOAD(ptr, order)              – Atomic load
+//   - __FLUENT_LIBC_PATH_ATOMIC_STORE(ptr, value, order)      – Atomic store
+//   - __FLUENT_LIBC_PATH_ATOMIC_ADD(ptr, value, order)        – Fetch-and-add, returns the old value
+//   - __FLUENT_LIBC_PATH_ATOMIC_SUB(ptr, value, order)        – Fetch-and-sub, returns the old value
+//   - __FLUENT_LIBC_PATH_ATOMIC_EXCHANGE(ptr, value, order)   – Swap, returns the old value
+//   - __FLUENT_LIBC_PATH_ATOMIC_CAS(ptr, expected, desired, weak, success, failure)
+//                                                             – Compare-and-swap, 1 if it succeeded
+//
+// Behavior:
+//   - <stdatomic.h> and _Atomic do not exist in C++ (before C++23), so these
+//     headers could not be included from C++ translation units. The macros
+//     wrap the GCC/Clang __atomic builtins instead, which work on plain
+//     integers and pointers in both languages.
+//   - Orders are the __ATOMIC_* constants (__ATOMIC_RELAXED ... __ATOMIC_SEQ_CST).
+//   - Shared fields are declared with their plain type and must only be
+//     accessed through these macros.
+//
+// Dependencies:
+//   - GCC or Clang (any compiler defining __GNUC__). Only needed off Windows,
+//     where the multi-threaded code is compiled.
+//
+
+// ============= MACROS =============
+#ifndef _WIN32
+#   if !defined(__GNUC__) && !defined(__clang__)
+#       error "fluent_libc path: the multi-threaded headers need the GCC/Clang __atomic builtins"
+#   endif
+
+#   define __FLUENT_LIBC_PATH_ATOMIC_LOAD(ptr, order) __atomic_load_n((ptr), (order))
+#   define __FLUENT_LIBC_PATH_ATOMIC_STORE(ptr, value, order) __atomic_store_n((ptr), (value), (order))
+#   define __FLUENT_LIBC_PATH_ATOMIC_ADD(ptr, value, order) __atomic_fetch_add((ptr), (value), (order))
+#   define __FLUENT_LIBC_PATH_ATOMIC_SUB(ptr, value, order) __atomic_fetch_sub((ptr), (value), (order))
+#   define __FLUENT_LIBC_PATH_ATOMIC_EXCHANGE(ptr, value, order) __atomic_exchange_n((ptr), (value), (order))
+#   define __FLUENT_LIBC_PATH_ATOMIC_CAS(ptr, expected, desired, weak, success, failure) \
+        __atomic_compare_exchange_n((ptr), (expected), (desired), (weak), (success), (failure))
+#endif
+
+#endif //FLUENT_LIBC_PATH_ATOMIC_LIBRARY_H
@@ -0,0 +1,280 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_BUILDER_LIBRARY_H
+#define FLUENT_LIBC_PATH_BUILDER_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Path Builder
+// ----------------------------------------
+// A reusable path buffer for recursive algorithms: push a component, recurse, pop it.
+// Provides:
+//   - path_builder_init(builder, root)        – Starts a builder at root (may be NULL or empty)
+//   - path_builder_push(builder, name)        – Appends "/name"
+//   - path_builder_push_slice(builder, name)  – Same, on a path_slice_t
+//   - path_builder_pop(builder)               – Removes the last pushed component
+//   - path_builder_view(builder)              – The current path, as a slice
+//   - path_builder_depth(builder)             – Number of pushed components
+//   - path_builder_destroy(builder)           – Releases the builder
+//
+// Behavior:
+//   - The builder owns one growable buffer and a stack of component boundaries.
+//     push copies the name once (O(len(name))) and pop only moves the end of the
+//     path back to the recorded boundary (O(1)).
+//   - Separators are inserted between components as needed; the root's trailing
+//     separators are kept only for "/" itself.
+//   - A pushed name may itself contain separators: pop removes it as one unit.
+//   - The buffer doubles when full, so visiting millions of entries costs a
+//     handful of allocations instead of one per path_join().
+//
+// Memory Management:
+//   - The view is NUL-terminated and points into the builder: it stays valid
+//     until the next push, pop or destroy.
+//   - path_builder_destroy() releases everything the builder owns.
+//
+// Example:
+// ----------------------------------------
+//   path_builder_t builder;
+//   path_builder_init(&builder, "/srv");
+//   path_builder_push(&builder, "www");       // "/srv/www"
+//   path_builder_push(&builder, "index.html"); // "/srv/www/index.html"
+//   path_builder_pop(&builder);               // "/srv/www"
+//   puts(path_builder_view(&builder).ptr);
+//   path_builder_destroy(&builder);
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ============= MACROS =============
+#ifndef PATH_BUILDER_INITIAL_CAPACITY
+#   define PATH_BUILDER_INITIAL_CAPACITY 256 // Initial size of the path buffer
+#endif
+
+#ifndef PATH_BUILDER_INITIAL_DEPTH
+#   define PATH_BUILDER_INITIAL_DEPTH 32 // Initial size of the boundary stack
+#endif
+
+// ============= TYPES =============
+/**
+ * @brief A path buffer with a stack of component boundaries.
+ */
+typedef struct
+{
+    char *buffer;      // The current path (NUL-terminated)
+    size_t len;        // Length of the current path
+    size_t cap;        // Capacity of buffer
+    size_t *marks;     // Path length before each push
+    size_t depth;      // Number of pushed components
+    size_t marks_cap;  // Capacity of marks
+} path_builder_t;
+
+// ============= HELPERS =============
+/**
+ * @brief Ensures the buffer can hold `extra` more bytes plus the terminator.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_builder_reserve(path_builder_t *const builder, const size_t extra)
+{
+    const size_t needed = builder->len + extra + 1;
+    if (needed <= builder->cap)
+    {
+        return 1;
+    }
+
+    size_t new_cap = builder->cap ? builder->cap : PATH_BUILDER_INITIAL_CAPACITY;
+    while (new_cap < needed)
+    {
+        new_cap *= 2;
+    }
+
+    char *buffer = (char *)realloc(builder->buffer, new_cap);
+    if (!buffer)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    builder->buffer = buffer;
+    builder->cap = new_cap;
+    return 1;
+}
+
+// ============= PUBLIC API =============
+/**
+ * @brief Initializes a builder at the given root.
+ *
+ * @param builder The builder to initialize.
+ * @param root The starting path, or NULL/empty to start from an empty relative path.
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int path_builder_init(path_builder_t *const builder, const char *const root)
+{
+    builder->buffer = NULL;
+    builder->len = 0;
+    builder->cap = 0;
+    builder->depth = 0;
+    builder->marks_cap = PATH_BUILDER_INITIAL_DEPTH;
+    builder->marks = (size_t *)malloc(builder->marks_cap * sizeof(size_t));
+    if (!builder->marks)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    // Keep the root without its trailing separators (except for "/" itself)
+    size_t root_len = root ? strlen(root) : 0;
+    while (root_len > 1 && root[root_len - 1] == PATH_SEPARATOR)
+    {
+        root_len--;
+    }
+
+    if (!__fluent_libc_path_builder_reserve(builder, root_len))
+    {
+        free(builder->marks);
+        builder->marks = NULL;
+        return 0; // Memory allocation failed
+    }
+
+    if (root_len)
+    {
+        memcpy(builder->buffer, root, root_len);
+    }
+    builder->len = root_len;
+    builder->buffer[root_len] = '\0';
+    return 1;
+}
+
+/**
+ * @brief Appends a component to the path.
+ *
+ * @param builder The builder.
+ * @param name The component to append.
+ * @return 1 on success, 0 if memory allocation failed (the builder is unchanged).
+ */
+FLUENT_LIBC_PATH_API int path_builder_push_slice(path_builder_t *const builder, const path_slice_t name)
+{
+    // Record where this component starts
+    if (builder->depth == builder->marks_cap)
+    {
+        const size_t new_cap = builder->marks_cap * 2;
+        size_t *marks = (size_t *)realloc(builder->marks, new_cap * sizeof(size_t));
+        if (!marks)
+        {
+            return 0; // Memory allocation failed
+        }
+
+        builder->marks = marks;
+        builder->marks_cap = new_cap;
+    }
+
+    // A separator is needed unless the path is empty or already ends with one
+    const int separator = builder->len > 0 && builder->buffer[builder->len - 1] != PATH_SEPARATOR;
+    if (!__fluent_libc_path_builder_reserve(builder, name.len + (size_t)separator))
+    {
+        return 0; // Memory allocation failed
+    }
+
+    builder->marks[builder->depth++] = builder->len;
+    if (separator)
+    {
+        builder->buffer[builder->len++] = PATH_SEPARATOR;
+    }
+    if (name.len)
+    {
+        memcpy(builder->buffer + builder->len, name.ptr, name.len);
+    }
+    builder->len += name.len;
+    builder->buffer[builder->len] = '\0';
+    return 1;
+}
+
+/**
+ * @brief Appends a component to the path.
+ *
+ * @param builder The builder.
+ * @param name The NUL-terminated component to append. Must not be NULL.
+ * @return 1 on success, 0 if memory allocation failed (the builder is unchanged).
+ */
+FLUENT_LIBC_PATH_API int path_builder_push(path_builder_t *const builder, const char *const name)
+{
+    return path_builder_push_slice(builder, path_slice(name));
+}
+
+/**
+ * @brief Removes the last pushed component.
+ *
+ * @param builder The builder.
+ * @return 1 if a component was removed, 0 if nothing was pushed.
+ */
+FLUENT_LIBC_PATH_API int path_builder_pop(path_builder_t *const builder)
+{
+    if (builder->depth == 0)
+    {
+        return 0; // Back at the root
+    }
+
+    builder->len = builder->marks[--builder->depth];
+    builder->buffer[builder->len] = '\0';
+    return 1;
+}
+
+/**
+ * @brief Returns the current path.
+ *
+ * @param builder The builder.
+ * @return A NUL-terminated view of the path, valid until the next push, pop or destroy.
+ */
+FLUENT_LIBC_PATH_API path_slice_t path_builder_view(const path_builder_t *const builder)
+{
+    return path_slice_from(builder->buffer, builder->len);
+}
+
+/**
+ * @brief Returns the number of components pushed since the root.
+ *
+ * @param builder The builder.
+ * @return The depth below the root.
+ */
+FLUENT_LIBC_PATH_API size_t path_builder_depth(const path_builder_t *const builder)
+{
+    return builder->depth;
+}
+
+/**
+ * @brief Releases the memory owned by a builder.
+ *
+ * @param builder The builder to destroy.
+ */
+FLUENT_LIBC_PATH_API void path_builder_destroy(path_builder_t *const builder)
+{
+    free(builder->buffer);
+    free(builder->marks);
+    builder->buffer = NULL;
+    builder->marks = NULL;
+    builder->len = 0;
+    builder->cap = 0;
+    builder->depth = 0;
+    builder->marks_cap = 0;
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_BUILDER_LIBRARY_H
@@ -0,0 +1,559 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_EXT_LIBRARY_H
+#define FLUENT_LIBC_PATH_EXT_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Extension Classification
+// ----------------------------------------
+// Maps file extensions (including multi-part ones such as .tar.gz) to caller-defined values.
+// Provides:
+//   - path_extension(path, &len)                              – Locates the extension of a path, no allocation
+//   - path_ext_table_build(table, entries, n, unknown, flags) – Builds a perfect hash of extensions
+//   - path_extension_classify(table, path)                    – Maps a path to the value of its extension
+//   - path_extension_slice / path_extension_classify_slice    – Same, on path_slice_t inputs
+//   - path_ext_table_destroy(table)                           – Releases a table
+//
+// Behavior:
+//   - Extensions are found by a single reverse scan from the end of the path to
+//     the last separator, recording up to PATH_EXT_MAX_PARTS dots on the way.
+//     A dot that starts the file name (".bashrc") does not begin an extension.
+//   - The table is a "hash and displace" perfect hash: every
+//     registered extension owns exactly one slot, so a lookup is one hash of the
+//     candidate extension, one displacement read and one comparison.
+//   - Multi-part extensions win over their last part: with ".tar.gz" and ".gz"
+//     registered, "a.tar.gz" maps to ".tar.gz" and "a.gz" to ".gz".
+//   - The table is built once (e.g. at startup) and is read-only afterwards, so
+//     lookups may run concurrently from any number of threads.
+//
+// Memory Management:
+//   - path_extension() returns a pointer into the input path.
+//   - path_ext_table_destroy() releases the memory owned by a table.
+//
+// Example:
+// ----------------------------------------
+//   enum asset_kind { ASSET_UNKNOWN, ASSET_IMAGE, ASSET_ARCHIVE };
+//   const path_ext_entry_t entries[] = {
+//       { ".png", ASSET_IMAGE }, { ".jpg", ASSET_IMAGE }, { ".tar.gz", ASSET_ARCHIVE },
+//   };
+//
+//   path_ext_table_t table;
+//   path_ext_table_build(&table, entries, 3, ASSET_UNKNOWN, PATH_EXT_CASE_INSENSITIVE);
+//   path_extension_classify(&table, "/in/photo.PNG");   // ASSET_IMAGE
+//   path_ext_table_destroy(&table);
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============= MACROS =============
+#ifndef PATH_EXT_MAX_PARTS
+#   define PATH_EXT_MAX_PARTS 4 // Maximum number of dot-separated parts in a registered extension
+#endif
+
+// ============= TYPES =============
+/**
+ * @brief Flags accepted by path_ext_table_build().
+ */
+typedef enum
+{
+    PATH_EXT_CASE_INSENSITIVE = 1 << 0 // Compare ASCII letters case-insensitively
+} path_ext_flags_t;
+
+/**
+ * @brief An extension and the value it maps to.
+ */
+typedef struct
+{
+    const char *extension; // The extension, with or without its leading dot (e.g. ".tar.gz")
+    int value;             // The value returned for paths with this extension
+} path_ext_entry_t;
+
+/**
+ * @brief A slot of the perfect hash.
+ */
+typedef struct
+{
+    const char *key; // Extension without the leading dot, or NULL for an empty slot
+    size_t len;      // Length of key
+    int value;       // Mapped value
+} __fluent_libc_path_ext_slot_t;
+
+/**
+ * @brief A perfect hash table of extensions.
+ */
+typedef struct
+{
+    __fluent_libc_path_ext_slot_t *slots; // Slot array (power of two)
+    size_t mask;                          // Number of slots minus one
+    uint32_t *seeds;                      // Displacement seed per bucket
+    size_t buckets;                       // Number of buckets
+    char *keys;                           // Storage of the normalized keys
+    size_t max_parts;                     // Most dot-separated parts in any key
+    int unknown;                          // Value returned when nothing matches
+    int flags;                            // path_ext_flags_t
+} path_ext_table_t;
+
+// ============= HELPERS =============
+/**
+ * @brief Hashes an extension, folding ASCII case if requested.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_ext_hash(const char *const key, const size_t len, const int fold)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned char c = (unsigned char)key[i];
+        if (fold && c >= 'A' && c <= 'Z')
+        {
+            c = (unsigned char)(c | 0x20);
+        }
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Derives a slot index from a key hash and a bucket's displacement seed.
+ */
+FLUENT_LIBC_PATH_API size_t __fluent_libc_path_ext_slot(const uint64_t hash, const uint32_t seed, const size_t mask)
+{
+    uint64_t x = hash ^ ((uint64_t)seed * 0x9E3779B97F4A7C15ULL);
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    return (size_t)x & mask;
+}
+
+/**
+ * @brief Compares two extensions, folding ASCII case if requested.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_ext_equal(const char *const a, const char *const b, const size_t len, const int fold)
+{
+    if (!fold)
+    {
+        return memcmp(a, b, len) == 0;
+    }
+
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned char x = (unsigned char)a[i], y = (unsigned char)b[i];
+        if (x >= 'A' && x <= 'Z') x = (unsigned char)(x | 0x20);
+        if (y >= 'A' && y <= 'Z') y = (unsigned char)(y | 0x20);
+        if (x != y)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Looks up one candidate extension in a table.
+ *
+ * @return The slot holding the extension, or NULL if it is not registered.
+ */
+FLUENT_LIBC_PATH_API const __fluent_libc_path_ext_slot_t *__fluent_libc_path_ext_find(
+    const path_ext_table_t *const table,
+    const char *const ext,
+    const size_t len
+)
+{
+    const int fold = table->flags & PATH_EXT_CASE_INSENSITIVE;
+    const uint64_t hash = __fluent_libc_path_ext_hash(ext, len, fold);
+    const uint32_t seed = table->seeds[(size_t)(hash >> 32) % table->buckets];
+    const __fluent_libc_path_ext_slot_t *slot = &table->slots[__fluent_libc_path_ext_slot(hash, seed, table->mask)];
+
+    if (slot->key && slot->len == len && __fluent_libc_path_ext_equal(slot->key, ext, len, fold))
+    {
+        return slot;
+    }
+
+    return NULL;
+}
+
+// ============= PUBLIC API =============
+/**
+ * @brief Locates the (last, single-part) extension of a path slice without allocating.
+ *
+ * @param path The path to inspect.
+ * @return A slice just past the dot inside path, or an empty slice with a NULL pointer
+ *         if the file name has no extension.
+ */
+FLUENT_LIBC_PATH_API path_slice_t path_extension_slice(const path_slice_t path)
+{
+    // Scan backwards from the end to the last separator
+    for (size_t i = path.len; i > 0; i--)
+    {
+        const char c = path.ptr[i - 1];
+        if (c == '/' || c == PATH_SEPARATOR)
+        {
+            break; // Reached the directory part without a dot
+        }
+
+        if (c == '.')
+        {
+            // A dot that starts the file name is not an extension
+            if (i - 1 == 0 || path.ptr[i - 2] == '/' || path.ptr[i - 2] == PATH_SEPARATOR)
+            {
+                break;
+            }
+
+            return path_slice_from(path.ptr + i, path.len - i);
+        }
+    }
+
+    return path_slice_from(NULL, 0);
+}
+
+/**
+ * @brief Locates the (last, single-part) extension of a path without allocating.
+ *
+ * @param path The path to inspect. Must not be NULL.
+ * @param len Receives the length of the extension, excluding the dot (may be NULL).
+ * @return A pointer just past the dot inside path, or NULL if the file name has no extension.
+ */
+FLUENT_LIBC_PATH_API const char *path_extension(const char *const path, size_t *const len)
+{
+    const path_slice_t ext = path_extension_slice(path_slice(path));
+    if (ext.ptr && len)
+    {
+        *len = ext.len;
+    }
+
+    return ext.ptr;
+}
+
+/**
+ * @brief Releases the memory owned by an extension table.
+ *
+ * @param table The table to destroy.
+ */
+FLUENT_LIBC_PATH_API void path_ext_table_destroy(path_ext_table_t *const table)
+{
+    if (!table)
+    {
+        return;
+    }
+
+    free(table->slots);
+    free(table->seeds);
+    free(table->keys);
+    memset(table, 0, sizeof(*table));
+}
+
+/**
+ * @brief Builds a perfect hash table mapping extensions to values.
+ *
+ * Duplicate extensions keep the value of their first occurrence.
+ *
+ * @param table The table to initialize. Must not be NULL.
+ * @param entries The extensions and their values.
+ * @param count The number of entries.
+ * @param unknown The value returned for paths whose extension is not registered.
+ * @param flags A combination of path_ext_flags_t values.
+ * @return 1 on success, 0 if the input is invalid or memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int path_ext_table_build(
+    path_ext_table_t *const table,
+    const path_ext_entry_t *const entries,
+    const size_t count,
+    const int unknown,
+    const int flags
+)
+{
+    // Validate the input
+    if (!table || (!entries && count > 0))
+    {
+        return 0; // Invalid arguments
+    }
+
+    memset(table, 0, sizeof(*table));
+    table->unknown = unknown;
+    table->flags = flags;
+    table->max_parts = 1;
+
+    // Size the slots at twice the next power of two, and use one bucket per two keys
+    size_t slots = 2;
+    while (slots < count * 2)
+    {
+        slots *= 2;
+    }
+    table->mask = slots - 1;
+    table->buckets = count / 2 + 1;
+
+    // Copy the keys without their leading dot, measuring the storage first
+    size_t bytes = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!entries[i].extension)
+        {
+            path_ext_table_destroy(table);
+            return 0; // Invalid entry
+        }
+        bytes += strlen(entries[i].extension) + 1;
+    }
+
+    table->slots = (__fluent_libc_path_ext_slot_t *)calloc(slots, sizeof(__fluent_libc_path_ext_slot_t));
+    table->seeds = (uint32_t *)calloc(table->buckets, sizeof(uint32_t));
+    table->keys = (char *)malloc(bytes + 1);
+    uint64_t *hashes = (uint64_t *)malloc((count + 1) * sizeof(uint64_t));
+    size_t *order = (size_t *)malloc((count + 1) * sizeof(size_t));
+    size_t *sizes = (size_t *)calloc(table->buckets + 1, sizeof(size_t));
+    size_t *taken = (size_t *)malloc((count + 1) * sizeof(size_t));
+    if (!table->slots || !table->seeds || !table->keys || !hashes || !order || !sizes || !taken)
+    {
+        free(hashes);
+        free(order);
+        free(sizes);
+        free(taken);
+        path_ext_table_destroy(table);
+        return 0; // Memory allocation failed
+    }
+
+    // Normalize the keys and drop duplicates
+    const int fold = flags & PATH_EXT_CASE_INSENSITIVE;
+    const char **keys = (const char **)malloc((count + 1) * sizeof(char *));
+    size_t *lens = (size_t *)malloc((count + 1) * sizeof(size_t));
+    int *values = (int *)malloc((count + 1) * sizeof(int));
+    size_t unique = 0;
+    int ok = keys && lens && values;
+    char *out = table->keys;
+    for (size_t i = 0; ok && i < count; i++)
+    {
+        const char *ext = entries[i].extension;
+        if (ext[0] == '.')
+        {
+            ext++;
+        }
+
+        const size_t len = strlen(ext);
+        const uint64_t hash = __fluent_libc_path_ext_hash(ext, len, fold);
+        int duplicate = 0;
+        for (size_t j = 0; j < unique; j++)
+        {
+            if (hashes[j] == hash && lens[j] == len && __fluent_libc_path_ext_equal(keys[j], ext, len, fold))
+            {
+                duplicate = 1;
+                break;
+            }
+        }
+
+        if (duplicate)
+        {
+            continue;
+        }
+
+        // Track the deepest multi-part extension
+        size_t parts = 1;
+        for (size_t j = 0; j < len; j++)
+        {
+            parts += ext[j] == '.';
+        }
+        if (parts > PATH_EXT_MAX_PARTS)
+        {
+            ok = 0; // Too many parts to be found by the reverse scan
+            break;
+        }
+        if (parts > table->max_parts)
+        {
+            table->max_parts = parts;
+        }
+
+        memcpy(out, ext, len + 1);
+        keys[unique] = out;
+        lens[unique] = len;
+        values[unique] = entries[i].value;
+        hashes[unique] = hash;
+        out += len + 1;
+        sizes[(size_t)(hash >> 32) % table->buckets]++;
+        unique++;
+    }
+
+    // Place the largest buckets first: they are the hardest to fit
+    for (size_t i = 0; ok && i < unique; i++)
+    {
+        order[i] = i;
+    }
+
+    // (ties are ordered by bucket so every bucket's keys stay contiguous)
+    for (size_t i = 1; ok && i < unique; i++)
+    {
+        const size_t key = order[i];
+        const size_t bucket = (size_t)(hashes[key] >> 32) % table->buckets;
+        size_t j = i;
+        while (j > 0)
+        {
+            const size_t prev = (size_t)(hashes[order[j - 1]] >> 32) % table->buckets;
+            if (sizes[prev] > sizes[bucket] || (sizes[prev] == sizes[bucket] && prev <= bucket))
+            {
+                break;
+            }
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = key;
+    }
+
+    // For each bucket, search a seed that sends all of its keys to free, distinct slots
+    size_t i = 0;
+    while (ok && i < unique)
+    {
+        const size_t bucket = (size_t)(hashes[order[i]] >> 32) % table->buckets;
+        size_t end = i;
+        while (end < unique && (size_t)(hashes[order[end]] >> 32) % table->buckets == bucket)
+        {
+            end++;
+        }
+
+        uint32_t seed = 0;
+        for (;;)
+        {
+            size_t placed = 0;
+            for (size_t k = i; k < end; k++)
+            {
+                const size_t slot = __fluent_libc_path_ext_slot(hashes[order[k]], seed, table->mask);
+                int free_slot = !table->slots[slot].key;
+                for (size_t t = 0; free_slot && t < placed; t++)
+                {
+                    free_slot = taken[t] != slot;
+                }
+
+                if (!free_slot)
+                {
+                    break;
+                }
+                taken[placed++] = slot;
+            }
+
+            if (placed == end - i)
+            {
+                break; // Every key of the bucket fits
+            }
+
+            if (++seed == 0)
+            {
+                ok = 0; // No seed works (identical 64-bit hashes)
+                break;
+            }
+        }
+
+        // Commit the bucket
+        table->seeds[bucket] = seed;
+        for (size_t k = i; ok && k < end; k++)
+        {
+            __fluent_libc_path_ext_slot_t *slot = &table->slots[taken[k - i]];
+            slot->key = keys[order[k]];
+            slot->len = lens[order[k]];
+            slot->value = values[order[k]];
+        }
+
+        i = end;
+    }
+
+    free(hashes);
+    free(order);
+    free(sizes);
+    free(taken);
+    free(keys);
+    free(lens);
+    free(values);
+
+    if (!ok)
+    {
+        path_ext_table_destroy(table);
+        return 0; // Invalid entries or memory allocation failed
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Maps a path slice to the value registered for its extension.
+ *
+ * The longest registered multi-part extension wins ("a.tar.gz" prefers
+ * ".tar.gz" over ".gz"). Only the file name is scanned, backwards from the
+ * end of the slice. No allocation is performed.
+ *
+ * @param table The table built by path_ext_table_build(). Must not be NULL.
+ * @param path The path to classify.
+ * @return The registered value, or the table's unknown value.
+ */
+FLUENT_LIBC_PATH_API int path_extension_classify_slice(const path_ext_table_t *const table, const path_slice_t path)
+{
+    if (!table || !table->slots || !path.ptr)
+    {
+        return table ? table->unknown : 0; // Invalid arguments
+    }
+
+    // Reverse scan: remember the dots of the file name, nearest first
+    size_t dots[PATH_EXT_MAX_PARTS];
+    size_t found = 0;
+    for (size_t i = path.len; i > 0 && found < table->max_parts; i--)
+    {
+        const char c = path.ptr[i - 1];
+        if (c == '/' || c == PATH_SEPARATOR)
+        {
+            break;
+        }
+
+        // A dot that starts the file name is not an extension
+        if (c == '.' && i - 1 > 0 && path.ptr[i - 2] != '/' && path.ptr[i - 2] != PATH_SEPARATOR)
+        {
+            dots[found++] = i;
+        }
+    }
+
+    // Try the longest candidate first
+    while (found > 0)
+    {
+        const size_t start = dots[--found];
+        const __fluent_libc_path_ext_slot_t *slot = __fluent_libc_path_ext_find(table, path.ptr + start, path.len - start);
+        if (slot)
+        {
+            return slot->value;
+        }
+    }
+
+    return table->unknown;
+}
+
+/**
+ * @brief Maps a path to the value registered for its extension.
+ *
+ * See path_extension_classify_slice().
+ *
+ * @param table The table built by path_ext_table_build(). Must not be NULL.
+ * @param path The path to classify. Must not be NULL.
+ * @return The registered value, or the table's unknown value.
+ */
+FLUENT_LIBC_PATH_API int path_extension_classify(const path_ext_table_t *const table, const char *const path)
+{
+    return path_extension_classify_slice(table, path_slice(path));
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_EXT_LIBRARY_H
@@ -0,0 +1,1318 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_GLOB_LIBRARY_H
+#define FLUENT_LIBC_PATH_GLOB_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Glob Pattern Set Matcher
+// ----------------------------------------
+// Compiles a set of gitignore-style glob patterns into one component-level automaton.
+// Provides:
+//   - path_glob_compile(glob, patterns, count)  – Compiles a pattern set
+//   - path_glob_match(glob, path, is_dir)       – Matches a path against the whole set
+//   - path_glob_match_slice(glob, path, is_dir) – Same, on a path_slice_t
+//   - path_glob_start/step/...                  – Steps the automaton one component at a time
+//   - path_glob_destroy(glob)                   – Releases a compiled set
+//
+// Pattern syntax (gitignore):
+//   - `*` matches any run of characters within a component, `?` matches one,
+//     `[a-z]` / `[!a-z]` match character classes and `\` escapes the next character.
+//   - `**` as a whole component matches zero or more components.
+//   - A leading `!` negates the pattern; the last matching pattern wins.
+//   - A trailing `/` restricts the pattern to directories.
+//   - Patterns without an inner `/` match at any depth; others are anchored.
+//   - Empty lines and lines starting with `#` are ignored.
+//   - As in git, nothing below a matched directory can be re-included.
+//
+// Behavior:
+//   - Every pattern is split into components that become states of a
+//     component-level NFA. Sets of NFA states are turned into DFA states lazily,
+//     so a path is matched against the whole set in a single pass over its components.
+//   - Each DFA state keeps a hash table of the literal components it expects
+//     (the literal prefilter) and only runs the wildcard matcher on the remaining
+//     components, whose own literal prefix/suffix is checked first.
+//   - Transitions on recently seen components are cached per state.
+//
+// Memory Management:
+//   - path_glob_destroy() releases everything owned by the set.
+//   - A compiled set grows its automaton while matching, so it must not be
+//     shared between threads without external locking.
+//
+// Example:
+// ----------------------------------------
+//   const char *patterns[] = { "*.o", "build/", "!keep.o" };
+//   path_glob_t glob;
+//   if (path_glob_compile(&glob, patterns, 3)) {
+//       path_glob_match(&glob, "src/main.o", 0);  // 1
+//       path_glob_match(&glob, "src/keep.o", 0);  // 0
+//       path_glob_destroy(&glob);
+//   }
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============= MACROS =============
+#ifndef PATH_GLOB_TRANSITION_CACHE
+#   define PATH_GLOB_TRANSITION_CACHE 4096 // Maximum number of cached component transitions
+#endif
+
+// ============= TYPES =============
+/**
+ * @brief Kinds of pattern components.
+ */
+typedef enum
+{
+    __FLUENT_LIBC_PATH_GLOB_LITERAL,  // Component without wildcards
+    __FLUENT_LIBC_PATH_GLOB_WILD,     // Component with *, ? or [...]
+    __FLUENT_LIBC_PATH_GLOB_ANY,      // Exactly one component of any name
+    __FLUENT_LIBC_PATH_GLOB_GLOBSTAR, // Zero or more components (**)
+    __FLUENT_LIBC_PATH_GLOB_END       // The pattern has been fully matched
+} __fluent_libc_path_glob_kind_t;
+
+/**
+ * @brief A state of the component-level NFA: one component of one pattern.
+ */
+typedef struct
+{
+    __fluent_libc_path_glob_kind_t kind; // What this component matches
+    char *text;                          // Unescaped literal, or the raw wildcard component
+    size_t len;                          // Length of text
+    size_t prefix_len;                   // Literal prefix every match starts with (wildcards)
+    size_t suffix_len;                   // Literal suffix every match ends with (wildcards)
+    size_t min_len;                      // Minimum length of a match (wildcards)
+    int affix;                           // 1 for "*literal", 2 for "literal*", 0 otherwise
+    size_t pattern;                      // Index of the owning pattern
+} __fluent_libc_path_glob_nfa_t;
+
+/**
+ * @brief A literal key expected by a DFA state and the NFA states it leads to.
+ */
+typedef struct
+{
+    uint64_t hash;    // Hash of the literal, 0 for an empty slot
+    const char *text; // The literal (owned by the NFA state)
+    size_t len;       // Length of the literal
+    size_t *targets;  // NFA states reached on this literal
+    size_t count;     // Number of targets
+} __fluent_libc_path_glob_literal_t;
+
+/**
+ * @brief A hash table of literal keys (whole components, suffixes or prefixes).
+ */
+typedef struct
+{
+    __fluent_libc_path_glob_literal_t *entries; // Open addressing slots
+    size_t cap;                                 // Capacity of entries (power of two)
+    size_t *lens;                               // Distinct key lengths, for suffix/prefix probes
+    size_t lens_len;                            // Number of distinct key lengths
+} __fluent_libc_path_glob_table_t;
+
+/**
+ * @brief A lazily built state of the component-level DFA.
+ */
+typedef struct
+{
+    uint64_t *set;                            // Set of NFA states
+    uint64_t *always;                         // NFA states reached on any component (closed)
+    __fluent_libc_path_glob_table_t literals; // Whole-component literals
+    __fluent_libc_path_glob_table_t suffixes; // Suffixes of "*literal" components
+    __fluent_libc_path_glob_table_t prefixes; // Prefixes of "literal*" components
+    size_t *wild;                             // NFA states that need the wildcard matcher
+    size_t wild_len;                          // Number of wildcard states
+    long accept_file;                         // Last pattern accepting a non-directory, or -1
+    long accept_dir;                          // Last pattern accepting a directory, or -1
+    int dead;                                 // 1 if no pattern can match any further
+} __fluent_libc_path_glob_dfa_t;
+
+/**
+ * @brief A cached transition of the DFA on a concrete component.
+ */
+typedef struct
+{
+    uint64_t hash; // Hash of (state, component), 0 for an empty slot
+    size_t from;   // Source DFA state
+    size_t to;     // Target DFA state
+    char *text;    // Copy of the component
+    size_t len;    // Length of the component
+} __fluent_libc_path_glob_cache_t;
+
+/**
+ * @brief A compiled set of glob patterns.
+ */
+typedef struct
+{
+    __fluent_libc_path_glob_nfa_t *nfa;     // NFA states
+    size_t nfa_len;                         // Number of NFA states
+    size_t words;                           // 64-bit words per NFA state set
+    unsigned char *negated;                 // Per pattern: 1 if the pattern starts with !
+    unsigned char *dir_only;                // Per pattern: 1 if the pattern ends with /
+    size_t patterns;                        // Number of compiled patterns
+    __fluent_libc_path_glob_dfa_t *dfa;     // DFA states built so far
+    size_t dfa_len;                         // Number of DFA states
+    size_t dfa_cap;                         // Capacity of dfa
+    size_t *index;                          // Hash index of DFA states by set (open addressing, +1)
+    size_t index_cap;                       // Capacity of index (power of two)
+    __fluent_libc_path_glob_cache_t *cache; // Transition cache
+    size_t cache_len;                       // Number of cached transitions
+    uint64_t *scratch;                      // Scratch NFA state set
+} path_glob_t;
+
+/**
+ * @brief A state of a compiled glob, obtained from path_glob_start()/path_glob_step().
+ */
+typedef size_t path_glob_state_t;
+
+// ============= HELPERS =============
+/**
+ * @brief Hashes a byte range (FNV-1a). Never returns 0.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_glob_hash(const void *const data, const size_t len, uint64_t seed)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    uint64_t hash = 14695981039346656037ULL ^ seed;
+    for (size_t i = 0; i < len; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash ? hash : 1;
+}
+
+/**
+ * @brief Hashes an NFA state set a word at a time. Never returns 0.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_glob_hash_set(const uint64_t *const set, const size_t words)
+{
+    uint64_t hash = 0x9E3779B97F4A7C15ULL;
+    for (size_t i = 0; i < words; i++)
+    {
+        hash = (hash ^ set[i]) * 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 32;
+    }
+
+    return hash ? hash : 1;
+}
+
+/**
+ * @brief Matches a single component against a wildcard component (*, ?, [...], \).
+ *
+ * @return 1 if the name matches, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_glob_wild_match(
+    const char *const pattern,
+    const size_t pattern_len,
+    const char *const name,
+    const size_t name_len
+)
+{
+    size_t p = 0, n = 0;
+    size_t star_p = (size_t)-1, star_n = 0;
+
+    while (n < name_len)
+    {
+        if (p < pattern_len)
+        {
+            const char c = pattern[p];
+            if (c == '*')
+            {
+                // Remember the star and first try to match it against nothing
+                star_p = ++p;
+                star_n = n;
+                continue;
+            }
+
+            if (c == '?')
+            {
+                p++;
+                n++;
+                continue;
+            }
+
+            if (c == '[')
+            {
+                // Parse the class, remembering whether it matched
+                size_t q = p + 1;
+                int negate = 0, matched = 0;
+                if (q < pattern_len && (pattern[q] == '!' || pattern[q] == '^'))
+                {
+                    negate = 1;
+                    q++;
+                }
+
+                // A ']' right after the opening bracket is a literal member
+                const unsigned char ch = (unsigned char)name[n];
+                int first = 1;
+                while (q < pattern_len && (first || pattern[q] != ']'))
+                {
+                    first = 0;
+                    unsigned char lo = (unsigned char)pattern[q];
+                    if (lo == '\\' && q + 1 < pattern_len)
+                    {
+                        lo = (unsigned char)pattern[++q];
+                    }
+                    q++;
+
+                    // Ranges such as a-z
+                    unsigned char hi = lo;
+                    if (q + 1 < pattern_len && pattern[q] == '-' && pattern[q + 1] != ']')
+                    {
+                        hi = (unsigned char)pattern[++q];
+                        if (hi == '\\' && q + 1 < pattern_len)
+                        {
+                            hi = (unsigned char)pattern[++q];
+                        }
+                        q++;
+                    }
+
+                    if (ch >= lo && ch <= hi)
+                    {
+                        matched = 1;
+                    }
+                }
+
+                if (q < pattern_len && matched != negate)
+                {
+                    p = q + 1; // Skip the closing bracket
+                    n++;
+                    continue;
+                }
+
+                if (q >= pattern_len && name[n] == '[')
+                {
+                    p++; // Unterminated class: treat '[' literally
+                    n++;
+                    continue;
+                }
+            }
+            else
+            {
+                // Literal character, possibly escaped
+                size_t q = p;
+                if (c == '\\' && q + 1 < pattern_len)
+                {
+                    q++;
+                }
+
+                if (pattern[q] == name[n])
+                {
+                    p = q + 1;
+                    n++;
+                    continue;
+                }
+            }
+        }
+
+        // Mismatch: let the last star absorb one more character
+        if (star_p == (size_t)-1)
+        {
+            return 0;
+        }
+
+        p = star_p;
+        n = ++star_n;
+    }
+
+    // Only trailing stars may remain
+    while (p < pattern_len && pattern[p] == '*')
+    {
+        p++;
+    }
+
+    return p == pattern_len;
+}
+
+/**
+ * @brief Finds the closing bracket of the class that opens at text[open].
+ *
+ * @return The index of the closing ']', or open itself if the class is
+ *         unterminated (and the '[' is therefore a literal).
+ */
+FLUENT_LIBC_PATH_API size_t __fluent_libc_path_glob_class_end(
+    const char *const text,
+    const size_t len,
+    const size_t open
+)
+{
+    size_t q = open + 1;
+    if (q < len && (text[q] == '!' || text[q] == '^'))
+    {
+        q++;
+    }
+
+    // A ']' right after the opening bracket is a literal member
+    int first = 1;
+    while (q < len && (first || text[q] != ']'))
+    {
+        first = 0;
+        q += text[q] == '\\' ? 2 : 1;
+    }
+
+    return q < len ? q : open;
+}
+
+/**
+ * @brief Adds a component to the NFA under construction.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_glob_add_state(
+    path_glob_t *const glob,
+    size_t *const cap,
+    const __fluent_libc_path_glob_kind_t kind,
+    const char *const text,
+    const size_t len,
+    const size_t pattern
+)
+{
+    // Grow the NFA array
+    if (glob->nfa_len == *cap)
+    {
+        const size_t new_cap = *cap ? *cap * 2 : 64;
+        __fluent_libc_path_glob_nfa_t *nfa = (__fluent_libc_path_glob_nfa_t *)realloc(
+            glob->nfa, new_cap * sizeof(__fluent_libc_path_glob_nfa_t));
+        if (!nfa)
+        {
+            return 0; // Memory allocation failed
+        }
+
+        glob->nfa = nfa;
+        *cap = new_cap;
+    }
+
+    __fluent_libc_path_glob_nfa_t *state = &glob->nfa[glob->nfa_len];
+    memset(state, 0, sizeof(*state));
+    state->kind = kind;
+    state->pattern = pattern;
+
+    if (kind == __FLUENT_LIBC_PATH_GLOB_LITERAL || kind == __FLUENT_LIBC_PATH_GLOB_WILD)
+    {
+        state->text = (char *)malloc(len + 1);
+        if (!state->text)
+        {
+            return 0; // Memory allocation failed
+        }
+
+        if (kind == __FLUENT_LIBC_PATH_GLOB_LITERAL)
+        {
+            // Store literals unescaped so they can be compared directly
+            size_t out = 0;
+            for (size_t i = 0; i < len; i++)
+            {
+                if (text[i] == '\\' && i + 1 < len)
+                {
+                    i++;
+                }
+                state->text[out++] = text[i];
+            }
+            state->len = out;
+        }
+        else
+        {
+            memcpy(state->text, text, len);
+            state->len = len;
+
+            // Literal prefix: everything before the first special character
+            while (state->prefix_len < len && !strchr("*?[\\", text[state->prefix_len]))
+            {
+                state->prefix_len++;
+            }
+
+            // Literal suffix: everything after the last star, if it is plain.
+            // Stars inside a bracket class are members, not wildcards.
+            size_t last_star = len;
+            for (size_t i = 0; i < len; i++)
+            {
+                if (text[i] == '\\')
+                {
+                    i++;
+                }
+                else if (text[i] == '[')
+                {
+                    i = __fluent_libc_path_glob_class_end(text, len, i);
+                }
+                else if (text[i] == '*')
+                {
+                    last_star = i;
+                }
+            }
+
+            if (last_star < len)
+            {
+                size_t i = last_star + 1;
+                while (i < len && !strchr("*?[\\", text[i]))
+                {
+                    i++;
+                }
+                state->suffix_len = i == len ? len - last_star - 1 : 0;
+            }
+
+            // Minimum length: every non-star token consumes at least one character
+            for (size_t i = 0; i < len; i++)
+            {
+                if (text[i] == '*')
+                {
+                    continue;
+                }
+
+                if (text[i] == '\\')
+                {
+                    i++;
+                }
+                else if (text[i] == '[')
+                {
+                    // Skip to the closing bracket; an unterminated class is a literal '['
+                    i = __fluent_libc_path_glob_class_end(text, len, i);
+                }
+                state->min_len++;
+            }
+
+            // Plain "*literal" and "literal*" components are answered by hash lookups alone
+            if (len >= 2 && state->min_len == len - 1)
+            {
+                if (text[0] == '*' && state->suffix_len == len - 1)
+                {
+                    state->affix = 1;
+                }
+                else if (text[len - 1] == '*' && state->prefix_len == len - 1)
+                {
+                    state->affix = 2;
+                }
+            }
+        }
+        state->text[state->len] = '\0';
+    }
+
+    glob->nfa_len++;
+    return 1;
+}
+
+/**
+ * @brief Parses one pattern into NFA states.
+ *
+ * @return 1 on success (including skipped comment/blank lines), 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_glob_parse(
+    path_glob_t *const glob,
+    size_t *const cap,
+    size_t *const patterns_cap,
+    const char *pattern
+)
+{
+    size_t len = strlen(pattern);
+
+    // Skip blank lines and comments
+    if (len == 0 || pattern[0] == '#')
+    {
+        return 1;
+    }
+
+    // Strip unescaped trailing spaces
+    while (len > 0 && pattern[len - 1] == ' ' && (len < 2 || pattern[len - 2] != '\\'))
+    {
+        len--;
+    }
+
+    // Handle negation
+    int negated = 0;
+    if (pattern[0] == '!')
+    {
+        negated = 1;
+        pattern++;
+        len--;
+    }
+
+    // Handle the directory-only marker
+    int dir_only = 0;
+    if (len > 0 && pattern[len - 1] == '/')
+    {
+        dir_only = 1;
+        len--;
+    }
+
+    if (len == 0)
+    {
+        return 1; // Nothing left to match
+    }
+
+    // Patterns with a separator are anchored; others match at any depth
+    const int anchored = memchr(pattern, '/', len) != NULL;
+    if (pattern[0] == '/')
+    {
+        pattern++;
+        len--;
+    }
+
+    // Record the per-pattern flags
+    if (glob->patterns == *patterns_cap)
+    {
+        const size_t new_cap = *patterns_cap ? *patterns_cap * 2 : 16;
+        unsigned char *neg = (unsigned char *)realloc(glob->negated, new_cap);
+        if (!neg)
+        {
+            return 0; // Memory allocation failed
+        }
+        glob->negated = neg;
+
+        unsigned char *dir = (unsigned char *)realloc(glob->dir_only, new_cap);
+        if (!dir)
+        {
+            return 0; // Memory allocation failed
+        }
+        glob->dir_only = dir;
+        *patterns_cap = new_cap;
+    }
+
+    const size_t index = glob->patterns++;
+    glob->negated[index] = (unsigned char)negated;
+    glob->dir_only[index] = (unsigned char)dir_only;
+
+    if (!anchored && !__fluent_libc_path_glob_add_state(glob, cap, __FLUENT_LIBC_PATH_GLOB_GLOBSTAR, NULL, 0, index))
+    {
+        return 0; // Memory allocation failed
+    }
+
+    // Split the pattern into components
+    size_t start = 0;
+    while (start < len)
+    {
+        size_t end = start;
+        while (end < len && pattern[end] != '/')
+        {
+            end++;
+        }
+
+        const char *component = pattern + start;
+        const size_t component_len = end - start;
+        start = end + 1;
+
+        if (component_len == 0)
+        {
+            continue; // Collapse repeated separators
+        }
+
+        // Classify the component
+        __fluent_libc_path_glob_kind_t kind = __FLUENT_LIBC_PATH_GLOB_LITERAL;
+        if (component_len == 2 && component[0] == '*' && component[1] == '*')
+        {
+            // A trailing ** matches everything inside, but not the directory itself
+            if (end >= len && !__fluent_libc_path_glob_add_state(glob, cap, __FLUENT_LIBC_PATH_GLOB_ANY, NULL, 0, index))
+            {
+                return 0; // Memory allocation failed
+            }
+            kind = __FLUENT_LIBC_PATH_GLOB_GLOBSTAR;
+        }
+        else if (component_len == 1 && component[0] == '*')
+        {
+            kind = __FLUENT_LIBC_PATH_GLOB_ANY;
+        }
+        else
+        {
+            for (size_t i = 0; i < component_len; i++)
+            {
+                if (component[i] == '\\')
+                {
+                    i++;
+                }
+                else if (component[i] == '*' || component[i] == '?' || component[i] == '[')
+                {
+                    kind = __FLUENT_LIBC_PATH_GLOB_WILD;
+                    break;
+                }
+            }
+        }
+
+        if (!__fluent_libc_path_glob_add_state(glob, cap, kind, component, component_len, index))
+        {
+            return 0; // Memory allocation failed
+        }
+    }
+
+    return __fluent_libc_path_glob_add_state(glob, cap, __FLUENT_LIBC_PATH_GLOB_END, NULL, 0, index);
+}
+
+/**
+ * @brief Adds an NFA state to a set, along with the states reachable through ** from it.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_glob_add(const path_glob_t *const glob, uint64_t *const set, size_t state)
+{
+    for (;;)
+    {
+        set[state / 64] |= 1ULL << (state % 64);
+        if (glob->nfa[state].kind != __FLUENT_LIBC_PATH_GLOB_GLOBSTAR)
+        {
+            return;
+        }
+        state++; // ** may match zero components
+    }
+}
+
+/**
+ * @brief Allocates a literal table sized for the given number of keys.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_glob_table_init(__fluent_libc_path_glob_table_t *const table, const size_t keys)
+{
+    table->cap = 1;
+    while (table->cap < keys * 2)
+    {
+        table->cap *= 2;
+    }
+
+    table->entries = (__fluent_libc_path_glob_literal_t *)calloc(table->cap, sizeof(__fluent_libc_path_glob_literal_t));
+    table->lens = NULL;
+    table->lens_len = 0;
+    return table->entries != NULL;
+}
+
+/**
+ * @brief Frees a literal table.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_glob_table_free(__fluent_libc_path_glob_table_t *const table)
+{
+    if (table->entries)
+    {
+        for (size_t i = 0; i < table->cap; i++)
+        {
+            free(table->entries[i].targets);
+        }
+    }
+
+    free(table->entries);
+    free(table->lens);
+}
+
+/**
+ * @brief Inserts a key leading to an NFA state into a literal table.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_glob_table_add(
+    __fluent_libc_path_glob_table_t *const table,
+    const char *const text,
+    const size_t len,
+    const size_t target
+)
+{
+    const uint64_t hash = __fluent_libc_path_glob_hash(text, len, 0);
+    size_t slot = (size_t)hash & (table->cap - 1);
+
+    // Find the key or an empty slot
+    while (table->entries[slot].hash != 0 &&
+           !(table->entries[slot].hash == hash && table->entries[slot].len == len &&
+             memcmp(table->entries[slot].text, text, len) == 0))
+    {
+        slot = (slot + 1) & (table->cap - 1);
+    }
+
+    __fluent_libc_path_glob_literal_t *literal = &table->entries[slot];
+    size_t *targets = (size_t *)realloc(literal->targets, (literal->count + 1) * sizeof(size_t));
+    if (!targets)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    literal->hash = hash;
+    literal->text = text;
+    literal->len = len;
+    literal->targets = targets;
+    literal->targets[literal->count++] = target;
+
+    // Remember every distinct key length
+    for (size_t i = 0; i < table->lens_len; i++)
+    {
+        if (table->lens[i] == len)
+        {
+            return 1;
+        }
+    }
+
+    size_t *lens = (size_t *)realloc(table->lens, (table->lens_len + 1) * sizeof(size_t));
+    if (!lens)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    table->lens = lens;
+    table->lens[table->lens_len++] = len;
+    return 1;
+}
+
+/**
+ * @brief Adds the targets of a key, if present, to an NFA state set.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_glob_table_apply(
+    const path_glob_t *const glob,
+    const __fluent_libc_path_glob_table_t *const table,
+    const char *const text,
+    const size_t len,
+    uint64_t *const set
+)
+{
+    const uint64_t hash = __fluent_libc_path_glob_hash(text, len, 0);
+    size_t slot = (size_t)hash & (table->cap - 1);
+    while (table->entries[slot].hash != 0)
+    {
+        const __fluent_libc_path_glob_literal_t *literal = &table->entries[slot];
+        if (literal->hash == hash && literal->len == len && memcmp(literal->text, text, len) == 0)
+        {
+            for (size_t i = 0; i < literal->count; i++)
+            {
+                __fluent_libc_path_glob_add(glob, set, literal->targets[i]);
+            }
+            return;
+        }
+        slot = (slot + 1) & (table->cap - 1);
+    }
+}
+
+/**
+ * @brief Frees the memory owned by a DFA state.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_glob_dfa_free(__fluent_libc_path_glob_dfa_t *const dfa)
+{
+    __fluent_libc_path_glob_table_free(&dfa->literals);
+    __fluent_libc_path_glob_table_free(&dfa->suffixes);
+    __fluent_libc_path_glob_table_free(&dfa->prefixes);
+    free(dfa->wild);
+    free(dfa->set);
+}
+
+/**
+ * @brief Returns the DFA state for an (already closed) NFA state set, building it if needed.
+ *
+ * @param glob The compiled glob.
+ * @param set The NFA state set; copied if a new state is built.
+ * @param out Receives the DFA state index.
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_glob_intern(path_glob_t *const glob, const uint64_t *const set, size_t *const out)
+{
+    const size_t bytes = glob->words * sizeof(uint64_t);
+    const uint64_t hash = __fluent_libc_path_glob_hash_set(set, glob->words);
+
+    // Look the set up in the index
+    size_t slot = (size_t)hash & (glob->index_cap - 1);
+    while (glob->index[slot] != 0)
+    {
+        const size_t candidate = glob->index[slot] - 1;
+        if (memcmp(glob->dfa[candidate].set, set, bytes) == 0)
+        {
+            *out = candidate;
+            return 1;
+        }
+        slot = (slot + 1) & (glob->index_cap - 1);
+    }
+
+    // Grow the DFA state array
+    if (glob->dfa_len == glob->dfa_cap)
+    {
+        const size_t new_cap = glob->dfa_cap ? glob->dfa_cap * 2 : 16;
+        __fluent_libc_path_glob_dfa_t *dfa = (__fluent_libc_path_glob_dfa_t *)realloc(
+            glob->dfa, new_cap * sizeof(__fluent_libc_path_glob_dfa_t));
+        if (!dfa)
+        {
+            return 0; // Memory allocation failed
+        }
+        glob->dfa = dfa;
+        glob->dfa_cap = new_cap;
+    }
+
+    // Build the new state
+    __fluent_libc_path_glob_dfa_t *dfa = &glob->dfa[glob->dfa_len];
+    memset(dfa, 0, sizeof(*dfa));
+    dfa->accept_file = -1;
+    dfa->accept_dir = -1;
+    dfa->set = (uint64_t *)malloc(bytes * 2);
+    if (!dfa->set)
+    {
+        return 0; // Memory allocation failed
+    }
+    memcpy(dfa->set, set, bytes);
+    dfa->always = dfa->set + glob->words;
+    memset(dfa->always, 0, bytes);
+
+    // Count the literal and wildcard states to size the tables
+    size_t literals = 0, suffixes = 0, prefixes = 0, wild = 0;
+    int empty = 1;
+    for (size_t i = 0; i < glob->nfa_len; i++)
+    {
+        if (!(set[i / 64] & (1ULL << (i % 64))))
+        {
+            continue;
+        }
+
+        empty = 0;
+        const __fluent_libc_path_glob_nfa_t *nfa = &glob->nfa[i];
+        if (nfa->kind == __FLUENT_LIBC_PATH_GLOB_LITERAL)
+        {
+            literals++;
+        }
+        else if (nfa->kind == __FLUENT_LIBC_PATH_GLOB_WILD)
+        {
+            suffixes += nfa->affix == 1;
+            prefixes += nfa->affix == 2;
+            wild += nfa->affix == 0;
+        }
+    }
+
+    dfa->dead = empty;
+    dfa->wild = wild ? (size_t *)malloc(wild * sizeof(size_t)) : NULL;
+    if (!__fluent_libc_path_glob_table_init(&dfa->literals, literals) ||
+        !__fluent_libc_path_glob_table_init(&dfa->suffixes, suffixes) ||
+        !__fluent_libc_path_glob_table_init(&dfa->prefixes, prefixes) ||
+        (wild && !dfa->wild))
+    {
+        __fluent_libc_path_glob_dfa_free(dfa);
+        return 0; // Memory allocation failed
+    }
+
+    // Fill in transitions and acceptance
+    int ok = 1;
+    for (size_t i = 0; ok && i < glob->nfa_len; i++)
+    {
+        if (!(set[i / 64] & (1ULL << (i % 64))))
+        {
+            continue;
+        }
+
+        const __fluent_libc_path_glob_nfa_t *nfa = &glob->nfa[i];
+        switch (nfa->kind)
+        {
+            case __FLUENT_LIBC_PATH_GLOB_LITERAL:
+                ok = __fluent_libc_path_glob_table_add(&dfa->literals, nfa->text, nfa->len, i + 1);
+                break;
+            case __FLUENT_LIBC_PATH_GLOB_WILD:
+                if (nfa->affix == 1)
+                {
+                    ok = __fluent_libc_path_glob_table_add(&dfa->suffixes, nfa->text + 1, nfa->len - 1, i + 1);
+                }
+                else if (nfa->affix == 2)
+                {
+                    ok = __fluent_libc_path_glob_table_add(&dfa->prefixes, nfa->text, nfa->len - 1, i + 1);
+                }
+                else
+                {
+                    dfa->wild[dfa->wild_len++] = i;
+                }
+                break;
+            case __FLUENT_LIBC_PATH_GLOB_ANY:
+                __fluent_libc_path_glob_add(glob, dfa->always, i + 1);
+                break;
+            case __FLUENT_LIBC_PATH_GLOB_GLOBSTAR:
+                __fluent_libc_path_glob_add(glob, dfa->always, i); // ** consumes the component and stays
+                break;
+            case __FLUENT_LIBC_PATH_GLOB_END:
+                // Patterns are numbered in order, so the highest index is the last match
+                if ((long)nfa->pattern > dfa->accept_dir)
+                {
+                    dfa->accept_dir = (long)nfa->pattern;
+                }
+                if (!glob->dir_only[nfa->pattern] && (long)nfa->pattern > dfa->accept_file)
+                {
+                    dfa->accept_file = (long)nfa->pattern;
+                }
+                break;
+        }
+    }
+
+    if (!ok)
+    {
+        __fluent_libc_path_glob_dfa_free(dfa);
+        return 0; // Memory allocation failed
+    }
+
+    // Grow the index if it is getting full
+    if ((glob->dfa_len + 1) * 2 > glob->index_cap)
+    {
+        const size_t new_cap = glob->index_cap * 2;
+        size_t *index = (size_t *)calloc(new_cap, sizeof(size_t));
+        if (!index)
+        {
+            __fluent_libc_path_glob_dfa_free(dfa);
+            return 0; // Memory allocation failed
+        }
+
+        for (size_t i = 0; i < glob->dfa_len; i++)
+        {
+            size_t s = (size_t)__fluent_libc_path_glob_hash_set(glob->dfa[i].set, glob->words) & (new_cap - 1);
+            while (index[s] != 0)
+            {
+                s = (s + 1) & (new_cap - 1);
+            }
+            index[s] = i + 1;
+        }
+
+        free(glob->index);
+        glob->index = index;
+        glob->index_cap = new_cap;
+
+        slot = (size_t)hash & (new_cap - 1);
+        while (glob->index[slot] != 0)
+        {
+            slot = (slot + 1) & (new_cap - 1);
+        }
+    }
+
+    glob->index[slot] = glob->dfa_len + 1;
+    *out = glob->dfa_len++;
+    return 1;
+}
+
+// ============= PUBLIC API =============
+/**
+ * @brief Releases every resource owned by a compiled glob.
+ *
+ * @param glob The glob to destroy. May have been partially compiled.
+ */
+FLUENT_LIBC_PATH_API void path_glob_destroy(path_glob_t *const glob)
+{
+    if (!glob)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < glob->nfa_len; i++)
+    {
+        free(glob->nfa[i].text);
+    }
+
+    for (size_t i = 0; i < glob->dfa_len; i++)
+    {
+        __fluent_libc_path_glob_dfa_free(&glob->dfa[i]);
+    }
+
+    if (glob->cache)
+    {
+        for (size_t i = 0; i < PATH_GLOB_TRANSITION_CACHE * 2; i++)
+        {
+            free(glob->cache[i].text);
+        }
+    }
+
+    free(glob->nfa);
+    free(glob->negated);
+    free(glob->dir_only);
+    free(glob->dfa);
+    free(glob->index);
+    free(glob->cache);
+    free(glob->scratch);
+    memset(glob, 0, sizeof(*glob));
+}
+
+/**
+ * @brief Compiles a set of gitignore-style patterns into a single automaton.
+ *
+ * @param glob The glob to initialize. Must not be NULL.
+ * @param patterns The patterns, in priority order (later patterns win).
+ * @param count The number of patterns.
+ * @return 1 on success, 0 if the input is invalid or memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int path_glob_compile(path_glob_t *const glob, const char *const *const patterns, const size_t count)
+{
+    // Validate the input
+    if (!glob || (!patterns && count > 0))
+    {
+        return 0; // Invalid arguments
+    }
+
+    memset(glob, 0, sizeof(*glob));
+
+    // Build the NFA
+    size_t cap = 0, patterns_cap = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (patterns[i] && !__fluent_libc_path_glob_parse(glob, &cap, &patterns_cap, patterns[i]))
+        {
+            path_glob_destroy(glob);
+            return 0; // Memory allocation failed
+        }
+    }
+
+    // Allocate the DFA bookkeeping
+    glob->words = glob->nfa_len / 64 + 1;
+    glob->index_cap = 64;
+    glob->index = (size_t *)calloc(glob->index_cap, sizeof(size_t));
+    glob->cache = (__fluent_libc_path_glob_cache_t *)calloc(PATH_GLOB_TRANSITION_CACHE * 2, sizeof(__fluent_libc_path_glob_cache_t));
+    glob->scratch = (uint64_t *)calloc(glob->words, sizeof(uint64_t));
+    if (!glob->index || !glob->cache || !glob->scratch)
+    {
+        path_glob_destroy(glob);
+        return 0; // Memory allocation failed
+    }
+
+    // The start state: the first component of every pattern
+    int first = 1;
+    for (size_t i = 0; i < glob->nfa_len; i++)
+    {
+        if (first)
+        {
+            __fluent_libc_path_glob_add(glob, glob->scratch, i);
+        }
+        first = glob->nfa[i].kind == __FLUENT_LIBC_PATH_GLOB_END;
+    }
+
+    size_t initial;
+    if (!__fluent_libc_path_glob_intern(glob, glob->scratch, &initial))
+    {
+        path_glob_destroy(glob);
+        return 0; // Memory allocation failed
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Returns the initial state of a compiled glob (before any component).
+ */
+FLUENT_LIBC_PATH_API path_glob_state_t path_glob_start(const path_glob_t *const glob)
+{
+    (void)glob;
+    return 0;
+}
+
+/**
+ * @brief Advances a glob state by one path component.
+ *
+ * @param glob The compiled glob.
+ * @param state The current state.
+ * @param name The component (not NUL-terminated).
+ * @param len The length of the component.
+ * @param next Receives the next state.
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int path_glob_step(
+    path_glob_t *const glob,
+    const path_glob_state_t state,
+    const char *const name,
+    const size_t len,
+    path_glob_state_t *const next
+)
+{
+    const __fluent_libc_path_glob_dfa_t *dfa = &glob->dfa[state];
+
+    // Dead states stay dead
+    if (dfa->dead)
+    {
+        *next = state;
+        return 1;
+    }
+
+    // Consult the transition cache
+    const uint64_t key = __fluent_libc_path_glob_hash(name, len, (uint64_t)state * 0x9E3779B97F4A7C15ULL);
+    const size_t mask = PATH_GLOB_TRANSITION_CACHE * 2 - 1;
+    size_t slot = (size_t)key & mask;
+    while (glob->cache[slot].hash != 0)
+    {
+        const __fluent_libc_path_glob_cache_t *entry = &glob->cache[slot];
+        if (entry->hash == key && entry->from == state && entry->len == len && memcmp(entry->text, name, len) == 0)
+        {
+            *next = entry->to;
+            return 1;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // Start from the states reachable on any component (already closed)
+    uint64_t *set = glob->scratch;
+    memcpy(set, dfa->always, glob->words * sizeof(uint64_t));
+
+    // Literal prefilter: one hash lookup covers every literal component
+    if (dfa->literals.cap > 1)
+    {
+        __fluent_libc_path_glob_table_apply(glob, &dfa->literals, name, len, set);
+    }
+
+    // "*literal" and "literal*" components: one lookup per distinct key length
+    for (size_t i = 0; i < dfa->suffixes.lens_len; i++)
+    {
+        const size_t key_len = dfa->suffixes.lens[i];
+        if (key_len <= len)
+        {
+            __fluent_libc_path_glob_table_apply(glob, &dfa->suffixes, name + len - key_len, key_len, set);
+        }
+    }
+
+    for (size_t i = 0; i < dfa->prefixes.lens_len; i++)
+    {
+        const size_t key_len = dfa->prefixes.lens[i];
+        if (key_len <= len)
+        {
+            __fluent_libc_path_glob_table_apply(glob, &dfa->prefixes, name, key_len, set);
+        }
+    }
+
+    // Remaining wildcard components, after their literal prefix/suffix/length checks
+    // (the prefix and suffix are part of the minimum length, so they fit)
+    for (size_t i = 0; i < dfa->wild_len; i++)
+    {
+        const size_t index = dfa->wild[i];
+        const __fluent_libc_path_glob_nfa_t *nfa = &glob->nfa[index];
+        if (len < nfa->min_len ||
+            memcmp(name, nfa->text, nfa->prefix_len) != 0 ||
+            memcmp(name + len - nfa->suffix_len, nfa->text + nfa->len - nfa->suffix_len, nfa->suffix_len) != 0)
+        {
+            continue;
+        }
+
+        if (__fluent_libc_path_glob_wild_match(nfa->text, nfa->len, name, len))
+        {
+            __fluent_libc_path_glob_add(glob, set, index + 1);
+        }
+    }
+
+    if (!__fluent_libc_path_glob_intern(glob, set, next))
+    {
+        return 0; // Memory allocation failed
+    }
+
+    // Remember the transition while the cache has room
+    if (glob->cache_len < PATH_GLOB_TRANSITION_CACHE)
+    {
+        char *text = (char *)malloc(len ? len : 1);
+        if (text)
+        {
+            memcpy(text, name, len);
+            glob->cache[slot].hash = key;
+            glob->cache[slot].from = state;
+            glob->cache[slot].to = *next;
+            glob->cache[slot].text = text;
+            glob->cache[slot].len = len;
+            glob->cache_len++;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Checks whether no pattern can match at or below a state.
+ *
+ * @return 1 if the state is dead (descending further is pointless), 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int path_glob_state_dead(const path_glob_t *const glob, const path_glob_state_t state)
+{
+    return glob->dfa[state].dead;
+}
+
+/**
+ * @brief Checks whether the path that led to a state is matched by the set.
+ *
+ * @param glob The compiled glob.
+ * @param state The state reached after the last component.
+ * @param is_dir Whether the path names a directory (enables patterns ending in /).
+ * @return 1 if the last matching pattern is a positive one, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int path_glob_state_matches(const path_glob_t *const glob, const path_glob_state_t state, const int is_dir)
+{
+    const long accept = is_dir ? glob->dfa[state].accept_dir : glob->dfa[state].accept_file;
+    return accept >= 0 && !glob->negated[accept];
+}
+
+/**
+ * @brief Matches a path slice against every pattern of the set in one pass over its components.
+ *
+ * Leading, repeated and trailing separators are ignored. As in git, a path is
+ * matched as soon as one of its parent directories is.
+ *
+ * @param glob The compiled glob. Must not be NULL.
+ * @param path The path to match, relative to the patterns' base.
+ * @param is_dir Whether the path names a directory.
+ * @return 1 if the path is matched, 0 if not, -1 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int path_glob_match_slice(path_glob_t *const glob, const path_slice_t path, const int is_dir)
+{
+    // Validate the input
+    if (!glob || !path.ptr || !glob->dfa)
+    {
+        return 0; // Invalid arguments
+    }
+
+    path_glob_state_t state = path_glob_start(glob);
+    size_t i = 0;
+    for (;;)
+    {
+        // Skip separators
+        while (i < path.len && (path.ptr[i] == '/' || path.ptr[i] == PATH_SEPARATOR))
+        {
+            i++;
+        }
+
+        if (i == path.len)
+        {
+            break;
+        }
+
+        // Find the end of the component
+        const size_t start = i;
+        while (i < path.len && path.ptr[i] != '/' && path.ptr[i] != PATH_SEPARATOR)
+        {
+            i++;
+        }
+
+        if (!path_glob_step(glob, state, path.ptr + start, i - start, &state))
+        {
+            return -1; // Memory allocation failed
+        }
+
+        // Everything below a matched directory is matched too
+        size_t rest = i;
+        while (rest < path.len && (path.ptr[rest] == '/' || path.ptr[rest] == PATH_SEPARATOR))
+        {
+            rest++;
+        }
+
+        if (rest < path.len && path_glob_state_matches(glob, state, 1))
+        {
+            return 1;
+        }
+
+        if (path_glob_state_dead(glob, state))
+        {
+            return 0; // No pattern can match deeper components
+        }
+    }
+
+    return path_glob_state_matches(glob, state, is_dir);
+}
+
+/**
+ * @brief Matches a path against every pattern of the set in one pass over its components.
+ *
+ * See path_glob_match_slice().
+ *
+ * @param glob The compiled glob. Must not be NULL.
+ * @param path The path to match, relative to the patterns' base. Must not be NULL.
+ * @param is_dir Whether the path names a directory.
+ * @return 1 if the path is matched, 0 if not, -1 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int path_glob_match(path_glob_t *const glob, const char *const path, const int is_dir)
+{
+    return path_glob_match_slice(glob, path_slice(path), is_dir);
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_GLOB_LIBRARY_H
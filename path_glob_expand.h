@@ -0,0 +1,337 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_GLOB_EXPAND_LIBRARY_H
+#define FLUENT_LIBC_PATH_GLOB_EXPAND_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Filesystem Glob Expansion
+// ----------------------------------------
+// Expands a glob pattern against the filesystem, built on path_walk.h and path_glob.h.
+// Provides:
+//   - path_glob_expand(pattern, flags, arena, callback, user_data) – Streams every match
+//
+// Behavior:
+//   - The pattern is split into a literal prefix (the leading components without
+//     wildcards) and a wildcard suffix. The prefix is resolved once through
+//     get_real_path_buff; the suffix is compiled into an anchored path_glob_t.
+//   - The prefix directory is walked with path_walk while the glob automaton is
+//     stepped once per component. Directories whose state is dead (no pattern
+//     component can match below them) are never opened, so `src/*/x.c` only
+//     reads `src` and its direct children.
+//   - Results are streamed in directory order: no sorting, no per-result stat.
+//   - Matching follows path_glob.h (gitignore) syntax; `*` also matches names
+//     starting with a dot. A trailing `/` only matches directories.
+//   - Reported paths are absolute and normalized, as with path_walk().
+//
+// Memory Management:
+//   - When an arena is given, entry->path is copied into it and stays valid
+//     until the arena is destroyed; otherwise it is only valid during the callback.
+//
+// Dependencies:
+//   - path_walk.h, path_glob.h, path_arena.h
+//   - Windows: not supported, path_glob_expand() returns 0
+//
+// Example:
+// ----------------------------------------
+//   static int collect(const path_walk_entry_t *entry, void *user_data)
+//   {
+//       printf("%s\n", entry->path);
+//       return PATH_WALK_CONTINUE;
+//   }
+//
+//   path_arena_t arena = {0};
+//   path_glob_expand("src/**/*.c", 0, &arena, collect, NULL);
+//   path_arena_destroy(&arena);
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path_arena.h"
+#include "path_glob.h"
+#include "path_walk.h"
+
+#ifndef _WIN32
+// ============= TYPES =============
+/**
+ * @brief State shared with the walk callback during an expansion.
+ */
+typedef struct
+{
+    path_glob_t glob;             // Compiled wildcard suffix
+    path_glob_state_t *states;    // Glob state per walk depth
+    size_t states_cap;            // Capacity of states
+    path_arena_t *arena;          // Destination of reported paths (may be NULL)
+    path_walk_callback_t callback;
+    void *user_data;
+    int failed;                   // 1 if memory allocation failed
+} __fluent_libc_path_glob_expand_t;
+
+// ============= HELPERS =============
+/**
+ * @brief Checks whether a pattern component contains glob syntax.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_glob_is_wild(const char *const component, const size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (component[i] == '*' || component[i] == '?' || component[i] == '[' || component[i] == '\\')
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Reports a match, copying it into the arena first if one was given.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_glob_expand_emit(
+    __fluent_libc_path_glob_expand_t *const expand,
+    const path_walk_entry_t *const entry
+)
+{
+    if (!expand->arena)
+    {
+        return expand->callback(entry, expand->user_data);
+    }
+
+    // Hand out a copy that outlives the walk
+    char *copy = path_arena_strndup(expand->arena, entry->path, entry->path_len);
+    if (!copy)
+    {
+        expand->failed = 1;
+        return PATH_WALK_STOP; // Memory allocation failed
+    }
+
+    path_walk_entry_t owned = *entry;
+    owned.path = copy;
+    owned.name = copy + entry->path_len - entry->name_len;
+    return expand->callback(&owned, expand->user_data);
+}
+
+/**
+ * @brief Walk callback: steps the automaton, prunes dead subtrees and reports matches.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_glob_expand_visit(const path_walk_entry_t *const entry, void *const user_data)
+{
+    __fluent_libc_path_glob_expand_t *expand = (__fluent_libc_path_glob_expand_t *)user_data;
+
+    // Make room for this depth's state
+    if (entry->depth >= expand->states_cap)
+    {
+        const size_t new_cap = expand->states_cap * 2 > entry->depth + 1 ? expand->states_cap * 2 : entry->depth + 1;
+        path_glob_state_t *states = (path_glob_state_t *)realloc(expand->states, new_cap * sizeof(path_glob_state_t));
+        if (!states)
+        {
+            expand->failed = 1;
+            return PATH_WALK_STOP; // Memory allocation failed
+        }
+
+        expand->states = states;
+        expand->states_cap = new_cap;
+    }
+
+    // Walks are depth-first, so the parent's state is the one recorded one level up
+    path_glob_state_t state;
+    if (!path_glob_step(&expand->glob, expand->states[entry->depth - 1], entry->name, entry->name_len, &state))
+    {
+        expand->failed = 1;
+        return PATH_WALK_STOP; // Memory allocation failed
+    }
+    expand->states[entry->depth] = state;
+
+    const int is_dir = entry->type == PATH_WALK_TYPE_DIR;
+    if (path_glob_state_matches(&expand->glob, state, is_dir))
+    {
+        const int action = __fluent_libc_path_glob_expand_emit(expand, entry);
+        if (action == PATH_WALK_STOP)
+        {
+            return PATH_WALK_STOP;
+        }
+    }
+
+    // Do not open directories no pattern component can match below
+    return path_glob_state_dead(&expand->glob, state) ? PATH_WALK_SKIP : PATH_WALK_CONTINUE;
+}
+#endif
+
+/**
+ * @brief Expands a glob pattern against the filesystem, streaming matches to a callback.
+ *
+ * @param pattern The pattern to expand (path_glob.h syntax). Must not be NULL or empty.
+ * @param flags PATH_WALK_FOLLOW_LINKS and/or PATH_WALK_SAME_DEVICE.
+ * @param arena Arena receiving a persistent copy of every reported path, or NULL.
+ * @param callback The function to call for every match. Must not be NULL.
+ *                 Returning PATH_WALK_STOP ends the expansion.
+ * @param user_data Opaque pointer forwarded to the callback.
+ * @return 1 if the expansion completed (with or without matches), 0 on error.
+ */
+FLUENT_LIBC_PATH_API int path_glob_expand(
+    const char *const pattern,
+    const int flags,
+    path_arena_t *const arena,
+    const path_walk_callback_t callback,
+    void *const user_data
+)
+{
+#ifdef _WIN32
+    (void)pattern;
+    (void)flags;
+    (void)arena;
+    (void)callback;
+    (void)user_data;
+    return 0; // Not supported on Windows
+#else
+    // Validate the input
+    if (!pattern || pattern[0] == '\0' || !callback)
+    {
+        return 0; // Invalid arguments
+    }
+
+    // Find where the literal prefix ends: the start of the first wildcard component
+    const size_t len = strlen(pattern);
+    size_t prefix_end = 0; // End of the literal prefix (exclusive)
+    size_t suffix = len;   // Start of the wildcard suffix
+    size_t start = 0;
+    while (start < len)
+    {
+        size_t end = start;
+        while (end < len && pattern[end] != '/')
+        {
+            end++;
+        }
+
+        if (__fluent_libc_path_glob_is_wild(pattern + start, end - start))
+        {
+            suffix = start;
+            break;
+        }
+
+        prefix_end = end;
+        start = end + 1;
+    }
+
+    // Resolve the literal prefix once ("." when the pattern starts with a wildcard)
+    char prefix[PATH_MAX];
+    char resolved[PATH_MAX];
+    if (prefix_end >= sizeof(prefix))
+    {
+        return 0; // Prefix too long
+    }
+
+    if (prefix_end == 0)
+    {
+        prefix[0] = pattern[0] == '/' ? '/' : '.';
+        prefix[1] = '\0';
+    }
+    else
+    {
+        memcpy(prefix, pattern, prefix_end);
+        prefix[prefix_end] = '\0';
+    }
+
+    if (!get_real_path_buff(prefix, resolved))
+    {
+        return errno == ENOENT || errno == ENOTDIR; // A missing prefix simply has no matches
+    }
+
+    // Without wildcards the pattern names a single path
+    if (suffix == len)
+    {
+        struct stat st;
+        if (lstat(resolved, &st) != 0)
+        {
+            return 1; // No match
+        }
+
+        if (pattern[len - 1] == '/' && !S_ISDIR(st.st_mode))
+        {
+            return 1; // A trailing separator only matches directories
+        }
+
+        const char *name = strrchr(resolved, PATH_SEPARATOR);
+        name = name && name[1] != '\0' ? name + 1 : resolved;
+
+        __fluent_libc_path_glob_expand_t single;
+        memset(&single, 0, sizeof(single));
+        single.arena = arena;
+        single.callback = callback;
+        single.user_data = user_data;
+
+        path_walk_entry_t entry;
+        memset(&entry, 0, sizeof(entry));
+        entry.path = resolved;
+        entry.path_len = strlen(resolved);
+        entry.name = name;
+        entry.name_len = strlen(name);
+        entry.type = path_walk_type_from_mode(st.st_mode);
+        entry.parent_fd = -1;
+
+        __fluent_libc_path_glob_expand_emit(&single, &entry);
+        return !single.failed;
+    }
+
+    // Compile the wildcard suffix, anchored at the prefix directory
+    const size_t suffix_len = len - suffix;
+    char *anchored = (char *)malloc(suffix_len + 2);
+    if (!anchored)
+    {
+        return 0; // Memory allocation failed
+    }
+    anchored[0] = '/';
+    memcpy(anchored + 1, pattern + suffix, suffix_len + 1);
+
+    __fluent_libc_path_glob_expand_t expand;
+    memset(&expand, 0, sizeof(expand));
+    expand.arena = arena;
+    expand.callback = callback;
+    expand.user_data = user_data;
+
+    const char *patterns[] = { anchored };
+    const int compiled = path_glob_compile(&expand.glob, patterns, 1);
+    free(anchored);
+    if (!compiled)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    expand.states_cap = 16;
+    expand.states = (path_glob_state_t *)malloc(expand.states_cap * sizeof(path_glob_state_t));
+    if (!expand.states)
+    {
+        path_glob_destroy(&expand.glob);
+        return 0; // Memory allocation failed
+    }
+    expand.states[0] = path_glob_start(&expand.glob);
+
+    // Walk the prefix directory, pruning with the automaton
+    const int walked = path_walk(resolved, flags & ~PATH_WALK_POST_ORDER, __fluent_libc_path_glob_expand_visit, &expand);
+
+    free(expand.states);
+    path_glob_destroy(&expand.glob);
+
+    // A prefix that is not a directory simply has no matches below it
+    return (walked || errno == ENOTDIR) && !expand.failed;
+#endif
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_GLOB_EXPAND_LIBRARY_H
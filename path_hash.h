@@ -0,0 +1,410 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_HASH_LIBRARY_H
+#define FLUENT_LIBC_PATH_HASH_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Path Hashing
+// ----------------------------------------
+// Hashes the lexically normalized form of a path, without building it.
+// Provides:
+//   - path_hash(path)                    – Hash of the normalized path
+//   - path_hash_slice(path)              – Same, on a path_slice_t
+//   - path_hash_append(parent, name, n)  – Hash of parent/name derived from hash(parent)
+//   - path_hash_root(absolute)           – Hash of the empty relative path or of "/"
+//
+// Behavior:
+//   - Paths are hashed component by component: empty components and "." are
+//     skipped and ".." drops the previous component, so "a//b/./c", "a/b/c/"
+//     and "a/x/../b/c" all hash to the same value. Absolute and relative paths
+//     never collide by construction (they start from different roots).
+//   - Separators are located with memchr (vectorized by the C library) and each
+//     component is hashed 16 bytes at a time with a wyhash-style 64x64->128
+//     multiply-fold, so the path is read once.
+//   - The path hash is a chain: hash(parent/child) = mix(hash(parent), hash(child)),
+//     which is what lets path_hash_append() extend a parent's hash without
+//     touching the parent's bytes again.
+//   - Paths deeper than PATH_HASH_INLINE_DEPTH spill the ".." bookkeeping to the
+//     heap; if that allocation fails the path is rehashed without it (slower,
+//     same value), so the hash never depends on memory pressure.
+//   - This is a lexical hash: symbolic links are not resolved.
+//
+// Example:
+// ----------------------------------------
+//   uint64_t dir = path_hash("/srv/www/");
+//   uint64_t file = path_hash_append(dir, "index.html", 10);
+//   // file == path_hash("/srv//www/./index.html")
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============= MACROS =============
+#define __FLUENT_LIBC_PATH_HASH_P0 0xA0761D6478BD642FULL
+#define __FLUENT_LIBC_PATH_HASH_P1 0xE7037ED1A0B428DBULL
+#define __FLUENT_LIBC_PATH_HASH_P2 0x8EBC6AF09C88C6E3ULL
+#define __FLUENT_LIBC_PATH_HASH_P3 0x589965CC75374CC3ULL
+
+#ifndef PATH_HASH_INLINE_DEPTH
+#   define PATH_HASH_INLINE_DEPTH 64 // Components tracked on the stack before spilling to the heap
+#endif
+
+// ============= HELPERS =============
+/**
+ * @brief Multiplies two 64-bit values and folds the 128-bit product.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_hash_mum(const uint64_t a, const uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+    // Portable 64x64->128 multiplication
+    const uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    const uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    const uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo;
+    const uint64_t lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+    const uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+    const uint64_t upper = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    const uint64_t lower = (cross << 32) | (uint32_t)lo_lo;
+    return lower ^ upper;
+#endif
+}
+
+/**
+ * @brief Reads 8 unaligned bytes.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_hash_read64(const char *const p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/**
+ * @brief Hashes one path component.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_hash_bytes(const char *const data, const size_t len)
+{
+    uint64_t seed = __FLUENT_LIBC_PATH_HASH_P0 ^ len;
+    const char *p = data;
+    size_t left = len;
+
+    // Full 16-byte blocks
+    while (left > 16)
+    {
+        seed = __fluent_libc_path_hash_mum(
+            __fluent_libc_path_hash_read64(p) ^ __FLUENT_LIBC_PATH_HASH_P1,
+            __fluent_libc_path_hash_read64(p + 8) ^ seed
+        );
+        p += 16;
+        left -= 16;
+    }
+
+    // The tail (1..16 bytes), zero padded
+    char tail[16] = { 0 };
+    memcpy(tail, p, left);
+    return __fluent_libc_path_hash_mum(
+        __fluent_libc_path_hash_read64(tail) ^ __FLUENT_LIBC_PATH_HASH_P2,
+        __fluent_libc_path_hash_read64(tail + 8) ^ seed
+    );
+}
+
+/**
+ * @brief Chains a component hash onto a parent hash.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_hash_chain(const uint64_t parent, const uint64_t component)
+{
+    return __fluent_libc_path_hash_mum(parent ^ __FLUENT_LIBC_PATH_HASH_P0, component ^ __FLUENT_LIBC_PATH_HASH_P1);
+}
+
+/**
+ * @brief Checks whether a byte is a path separator.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_hash_is_sep(const char c)
+{
+    return c == '/' || c == PATH_SEPARATOR;
+}
+
+/**
+ * @brief Finds the next separator at or after p, or end if there is none.
+ */
+FLUENT_LIBC_PATH_API const char *__fluent_libc_path_hash_next_sep(const char *const p, const char *const end)
+{
+    const char *sep = (const char *)memchr(p, '/', (size_t)(end - p));
+#if PATH_SEPARATOR != '/'
+    const char *alt = (const char *)memchr(p, PATH_SEPARATOR, (size_t)(sep ? sep - p : end - p));
+    if (alt)
+    {
+        sep = alt;
+    }
+#endif
+    return sep ? sep : end;
+}
+
+/**
+ * @brief Hashes a path without the ".." stack, for when the stack cannot grow.
+ *
+ * A component is chained only if no later ".." drops it, which needs no memory
+ * but rescans the rest of the path for every component.
+ *
+ * @return The same hash path_hash_slice() computes with its stack.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_hash_rescan(
+    const char *p,
+    const char *const end,
+    const int absolute,
+    uint64_t hash
+)
+{
+    size_t depth = 0;
+    while (p < end)
+    {
+        // Skip separators, then isolate the next component
+        while (p < end && __fluent_libc_path_hash_is_sep(*p))
+        {
+            p++;
+        }
+        if (p == end)
+        {
+            break;
+        }
+
+        const char *sep = __fluent_libc_path_hash_next_sep(p, end);
+        const size_t len = (size_t)(sep - p);
+        const char *component = p;
+        p = sep;
+
+        if (len == 1 && component[0] == '.')
+        {
+            continue; // Current directory
+        }
+
+        if (len == 2 && component[0] == '.' && component[1] == '.')
+        {
+            if (depth > 0)
+            {
+                depth--; // Dropped a component that was never chained
+                continue;
+            }
+
+            if (!absolute)
+            {
+                hash = __fluent_libc_path_hash_chain(hash, __fluent_libc_path_hash_bytes(component, len));
+            }
+            continue;
+        }
+
+        // Look ahead for the ".." that drops this component, if any
+        size_t above = 0;
+        int kept = 1;
+        const char *q = p;
+        while (q < end)
+        {
+            while (q < end && __fluent_libc_path_hash_is_sep(*q))
+            {
+                q++;
+            }
+            if (q == end)
+            {
+                break;
+            }
+
+            const char *next = __fluent_libc_path_hash_next_sep(q, end);
+            if (next - q == 2 && q[0] == '.' && q[1] == '.')
+            {
+                if (above == 0)
+                {
+                    kept = 0;
+                    break;
+                }
+                above--;
+            }
+            else if (next - q != 1 || q[0] != '.')
+            {
+                above++;
+            }
+            q = next;
+        }
+
+        if (kept)
+        {
+            hash = __fluent_libc_path_hash_chain(hash, __fluent_libc_path_hash_bytes(component, len));
+        }
+        else
+        {
+            depth++;
+        }
+    }
+
+    return hash;
+}
+
+// ============= PUBLIC API =============
+/**
+ * @brief Returns the hash of an empty path: the relative root or "/".
+ *
+ * @param absolute Non-zero for the absolute root.
+ * @return The root hash.
+ */
+FLUENT_LIBC_PATH_API uint64_t path_hash_root(const int absolute)
+{
+    return absolute ? __FLUENT_LIBC_PATH_HASH_P2 : __FLUENT_LIBC_PATH_HASH_P3;
+}
+
+/**
+ * @brief Derives the hash of parent/name from the hash of parent.
+ *
+ * The name is a single component (it must not contain separators).
+ * An empty name or "." leaves the hash unchanged. ".." cannot be undone
+ * incrementally and is hashed as a regular name; use path_hash() for paths
+ * that need lexical ".." handling.
+ *
+ * @param parent The hash of the parent path.
+ * @param name The component to append.
+ * @param len The length of the component.
+ * @return The hash of the joined path.
+ */
+FLUENT_LIBC_PATH_API uint64_t path_hash_append(const uint64_t parent, const char *const name, const size_t len)
+{
+    if (len == 0 || (len == 1 && name[0] == '.'))
+    {
+        return parent;
+    }
+
+    return __fluent_libc_path_hash_chain(parent, __fluent_libc_path_hash_bytes(name, len));
+}
+
+/**
+ * @brief Hashes the lexically normalized form of a path slice.
+ *
+ * @param path The path to hash.
+ * @return The hash; equal for paths that normalize to the same components.
+ */
+#ifdef __FLUENT_LIBC_PATH_HOT_EXTERN
+uint64_t path_hash_slice(path_slice_t path);
+#else
+FLUENT_LIBC_PATH_HOT FLUENT_LIBC_PATH_API uint64_t path_hash_slice(const path_slice_t path)
+{
+    const char *p = path.ptr;
+    const char *end = path.ptr + path.len;
+    const int absolute = path.len > 0 && __fluent_libc_path_hash_is_sep(p[0]);
+
+    // Prefix hashes of the components seen so far, so ".." can step back
+    uint64_t inline_stack[PATH_HASH_INLINE_DEPTH];
+    uint64_t *stack = inline_stack;
+    size_t cap = PATH_HASH_INLINE_DEPTH;
+    size_t depth = 0;
+    uint64_t hash = path_hash_root(absolute);
+
+    while (p < end)
+    {
+        // Skip separators, then isolate the next component
+        while (p < end && __fluent_libc_path_hash_is_sep(*p))
+        {
+            p++;
+        }
+        if (p == end)
+        {
+            break;
+        }
+
+        const char *sep = __fluent_libc_path_hash_next_sep(p, end);
+        const size_t len = (size_t)(sep - p);
+        const char *component = p;
+        p = sep;
+
+        if (len == 1 && component[0] == '.')
+        {
+            continue; // Current directory
+        }
+
+        if (len == 2 && component[0] == '.' && component[1] == '.')
+        {
+            if (depth > 0)
+            {
+                hash = stack[--depth]; // Drop the previous component
+                continue;
+            }
+
+            if (absolute)
+            {
+                continue; // "/.." is "/"
+            }
+
+            // Relative paths keep leading ".." components
+            hash = __fluent_libc_path_hash_chain(hash, __fluent_libc_path_hash_bytes(component, len));
+            continue;
+        }
+
+        // Remember the prefix hash before descending
+        if (depth == cap)
+        {
+            const size_t new_cap = cap * 2;
+            uint64_t *grown = (uint64_t *)malloc(new_cap * sizeof(uint64_t));
+            if (!grown)
+            {
+                // Out of memory: start over without a stack
+                if (stack != inline_stack)
+                {
+                    free(stack);
+                }
+                return __fluent_libc_path_hash_rescan(path.ptr, end, absolute, path_hash_root(absolute));
+            }
+
+            memcpy(grown, stack, depth * sizeof(uint64_t));
+            if (stack != inline_stack)
+            {
+                free(stack);
+            }
+            stack = grown;
+            cap = new_cap;
+        }
+
+        stack[depth++] = hash;
+        hash = __fluent_libc_path_hash_chain(hash, __fluent_libc_path_hash_bytes(component, len));
+    }
+
+    if (stack != inline_stack)
+    {
+        free(stack);
+    }
+
+    return hash;
+}
+#endif
+
+/**
+ * @brief Hashes the lexically normalized form of a path.
+ *
+ * @param path The path to hash. NULL hashes like the empty path.
+ * @return The hash; equal for paths that normalize to the same components.
+ */
+FLUENT_LIBC_PATH_API uint64_t path_hash(const char *const path)
+{
+    return path_hash_slice(path_slice(path));
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_HASH_LIBRARY_H
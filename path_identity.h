@@ -0,0 +1,339 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_IDENTITY_LIBRARY_H
+#define FLUENT_LIBC_PATH_IDENTITY_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// File Identity
+// ----------------------------------------
+// Tells whether paths refer to the same file by (device, inode) instead of by name.
+// Provides:
+//   - path_identity(path, id)             – The (st_dev, st_ino) pair of the file path refers to
+//   - path_id_equal(a, b)                 – Compares two identities
+//   - path_same_file(a, b)                – 1 if both paths refer to the same file
+//   - path_id_cache_init(cache)           – A set of identities, for deduplication
+//   - path_id_cache_insert(cache, id)     – Adds an identity; tells whether it was new
+//   - path_id_cache_insert_path(cache, p) – Same, from a path (one statx)
+//   - path_id_cache_contains(cache, id)   – Membership test
+//   - path_id_cache_destroy(cache)        – Releases the set
+//
+// Behavior:
+//   - Comparing get_real_path() strings costs two resolutions and still
+//     misses hard links and bind mounts. An identity is one statx() asking
+//     only for STATX_INO (the device comes with every statx reply), and two
+//     identities compare as integers.
+//   - Symbolic links are followed, as stat() does.
+//   - Falls back to stat() where statx is unavailable; not supported on Windows.
+//   - The cache is an open-addressing hash set that doubles at half load.
+//
+// Memory Management:
+//   - Identities are plain values. The cache owns its slot array and must be
+//     released with path_id_cache_destroy().
+//
+// Example:
+// ----------------------------------------
+//   path_id_cache_t seen;
+//   path_id_cache_init(&seen);
+//   for (size_t i = 0; i < count; i++)
+//   {
+//       if (path_id_cache_insert_path(&seen, files[i]) == 1) { process(files[i]); } // First time seen
+//   }
+//   path_id_cache_destroy(&seen);
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_hash.h" // For __fluent_libc_path_hash_mum
+#include "path_probe.h" // For the statx fallback state
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#ifndef _WIN32
+#   include <fcntl.h>    // For AT_FDCWD
+#   include <sys/stat.h>
+#endif
+#ifdef __linux__
+#   include <sys/sysmacros.h> // For makedev
+#endif
+
+// ============= MACROS =============
+#ifndef PATH_ID_CACHE_INITIAL_CAPACITY
+#   define PATH_ID_CACHE_INITIAL_CAPACITY 64 // Initial number of slots (a power of two)
+#endif
+
+// ============= TYPES =============
+/**
+ * @brief The identity of a file: its device and inode numbers.
+ */
+typedef struct
+{
+    uint64_t dev; // Device, encoded as st_dev
+    uint64_t ino; // Inode number
+} path_id_t;
+
+/**
+ * @brief A slot of the identity cache.
+ */
+typedef struct
+{
+    path_id_t id; // The stored identity
+    int used;     // Non-zero if the slot holds an identity
+} __fluent_libc_path_id_slot_t;
+
+/**
+ * @brief A set of file identities.
+ */
+typedef struct
+{
+    __fluent_libc_path_id_slot_t *slots; // Slot array (power of two)
+    size_t mask;                         // Number of slots minus one
+    size_t count;                        // Number of stored identities
+} path_id_cache_t;
+
+// ============= HELPERS =============
+/**
+ * @brief Hashes an identity.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_id_hash(const path_id_t id)
+{
+    return __fluent_libc_path_hash_mum(id.dev ^ __FLUENT_LIBC_PATH_HASH_P0, id.ino ^ __FLUENT_LIBC_PATH_HASH_P1);
+}
+
+/**
+ * @brief Finds the slot holding an identity, or the free slot where it belongs.
+ */
+FLUENT_LIBC_PATH_API __fluent_libc_path_id_slot_t *__fluent_libc_path_id_cache_find(
+    const path_id_cache_t *const cache,
+    const path_id_t id
+)
+{
+    size_t i = (size_t)__fluent_libc_path_id_hash(id) & cache->mask;
+    while (cache->slots[i].used && (cache->slots[i].id.dev != id.dev || cache->slots[i].id.ino != id.ino))
+    {
+        i = (i + 1) & cache->mask; // Linear probing
+    }
+
+    return &cache->slots[i];
+}
+
+/**
+ * @brief Doubles the slot array.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_id_cache_grow(path_id_cache_t *const cache)
+{
+    const size_t old_slots = cache->mask + 1;
+    __fluent_libc_path_id_slot_t *old = cache->slots;
+    __fluent_libc_path_id_slot_t *slots =
+        (__fluent_libc_path_id_slot_t *)calloc(old_slots * 2, sizeof(__fluent_libc_path_id_slot_t));
+    if (!slots)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    cache->slots = slots;
+    cache->mask = old_slots * 2 - 1;
+    for (size_t i = 0; i < old_slots; i++)
+    {
+        if (old[i].used)
+        {
+            *__fluent_libc_path_id_cache_find(cache, old[i].id) = old[i];
+        }
+    }
+
+    free(old);
+    return 1;
+}
+
+// ============= PUBLIC API =============
+/**
+ * @brief Returns the identity of the file a path refers to (following symbolic links).
+ *
+ * @param path The path. Must not be NULL or empty.
+ * @param id Receives the identity.
+ * @return 1 on success, 0 on failure with errno set.
+ */
+FLUENT_LIBC_PATH_API int path_identity(const char *const path, path_id_t *const id)
+{
+    if (!path || path[0] == '\0' || !id)
+    {
+        errno = EINVAL;
+        return 0; // Invalid arguments
+    }
+
+#ifdef _WIN32
+    errno = ENOSYS;
+    return 0; // Not supported on Windows
+#else
+#   ifdef __linux__
+    if (!__fluent_libc_path_probe_no_statx)
+    {
+        struct statx st;
+        if (__fluent_libc_path_statx(AT_FDCWD, path, AT_STATX_DONT_SYNC, STATX_INO, &st) == 0)
+        {
+            id->dev = (uint64_t)makedev(st.stx_dev_major, st.stx_dev_minor);
+            id->ino = (uint64_t)st.stx_ino;
+            return 1;
+        }
+
+        if (errno != ENOSYS)
+        {
+            return 0; // The path cannot be resolved
+        }
+
+        __fluent_libc_path_probe_no_statx = 1; // Use stat() from now on
+    }
+#   endif
+
+    struct stat st;
+    if (stat(path, &st) != 0)
+    {
+        return 0; // The path cannot be resolved
+    }
+
+    id->dev = (uint64_t)st.st_dev;
+    id->ino = (uint64_t)st.st_ino;
+    return 1;
+#endif
+}
+
+/**
+ * @brief Compares two identities.
+ *
+ * @return 1 if they are the same file, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int path_id_equal(const path_id_t a, const path_id_t b)
+{
+    return a.dev == b.dev && a.ino == b.ino;
+}
+
+/**
+ * @brief Checks whether two paths refer to the same file, across hard links, symbolic links and bind mounts.
+ *
+ * @param a The first path.
+ * @param b The second path.
+ * @return 1 if they refer to the same file, 0 if not, -1 if either cannot be resolved (errno set).
+ */
+FLUENT_LIBC_PATH_API int path_same_file(const char *const a, const char *const b)
+{
+    path_id_t id_a;
+    path_id_t id_b;
+    if (!path_identity(a, &id_a) || !path_identity(b, &id_b))
+    {
+        return -1; // Either path cannot be resolved
+    }
+
+    return path_id_equal(id_a, id_b);
+}
+
+/**
+ * @brief Initializes an empty identity cache.
+ *
+ * @param cache The cache to initialize.
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int path_id_cache_init(path_id_cache_t *const cache)
+{
+    cache->count = 0;
+    cache->mask = PATH_ID_CACHE_INITIAL_CAPACITY - 1;
+    cache->slots = (__fluent_libc_path_id_slot_t *)calloc(PATH_ID_CACHE_INITIAL_CAPACITY, sizeof(__fluent_libc_path_id_slot_t));
+    return cache->slots != NULL;
+}
+
+/**
+ * @brief Checks whether an identity is in the cache.
+ *
+ * @param cache The cache.
+ * @param id The identity.
+ * @return 1 if present, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int path_id_cache_contains(const path_id_cache_t *const cache, const path_id_t id)
+{
+    return __fluent_libc_path_id_cache_find(cache, id)->used;
+}
+
+/**
+ * @brief Adds an identity to the cache.
+ *
+ * @param cache The cache.
+ * @param id The identity.
+ * @return 1 if it was added, 0 if it was already present, -1 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int path_id_cache_insert(path_id_cache_t *const cache, const path_id_t id)
+{
+    __fluent_libc_path_id_slot_t *slot = __fluent_libc_path_id_cache_find(cache, id);
+    if (slot->used)
+    {
+        return 0; // Already seen
+    }
+
+    // Keep the load at one half at most
+    if ((cache->count + 1) * 2 > cache->mask + 1)
+    {
+        if (!__fluent_libc_path_id_cache_grow(cache))
+        {
+            return -1; // Memory allocation failed
+        }
+
+        slot = __fluent_libc_path_id_cache_find(cache, id);
+    }
+
+    slot->id = id;
+    slot->used = 1;
+    cache->count++;
+    return 1;
+}
+
+/**
+ * @brief Adds the identity of the file a path refers to.
+ *
+ * @param cache The cache.
+ * @param path The path.
+ * @return 1 if the file was not in the cache yet, 0 if it was,
+ *         -1 if the path cannot be resolved or memory allocation failed (errno set).
+ */
+FLUENT_LIBC_PATH_API int path_id_cache_insert_path(path_id_cache_t *const cache, const char *const path)
+{
+    path_id_t id;
+    if (!path_identity(path, &id))
+    {
+        return -1; // The path cannot be resolved
+    }
+
+    return path_id_cache_insert(cache, id);
+}
+
+/**
+ * @brief Releases the memory owned by an identity cache.
+ *
+ * @param cache The cache to destroy.
+ */
+FLUENT_LIBC_PATH_API void path_id_cache_destroy(path_id_cache_t *const cache)
+{
+    free(cache->slots);
+    cache->slots = NULL;
+    cache->mask = 0;
+    cache->count = 0;
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_IDENTITY_LIBRARY_H
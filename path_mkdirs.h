@@ -0,0 +1,410 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_MKDIRS_LIBRARY_H
+#define FLUENT_LIBC_PATH_MKDIRS_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Recursive Directory Creation
+// ----------------------------------------
+// mkdir -p that only touches the missing part of the path.
+// Provides:
+//   - path_mkdirs(path, mode, flags) – Creates path and every missing parent
+//   - path_mkdirs_cache_clear()      – Forgets the directories known to exist
+//
+// Behavior:
+//   - The path is normalized once (repeated separators and "." dropped).
+//   - The leaf is probed first: an existing directory costs one syscall. If it
+//     is missing, the deepest existing ancestor is found by binary search over
+//     the prefixes (O(log depth) opens), then only the missing suffix is
+//     created with mkdirat() relative to that ancestor's descriptor, so no
+//     prefix is looked up twice and no EEXIST round trip is made per component.
+//   - Absolute directories created or found by path_mkdirs() are remembered in
+//     a small process-wide cache (keyed by path_hash_append() of each prefix).
+//     A later call still opens the leaf, but if it is missing the ancestor
+//     search starts from the deepest cached ancestor. If a cached directory
+//     has since been removed, the call notices (ENOENT) and retries uncached.
+//     PATH_MKDIRS_NO_CACHE bypasses the cache.
+//   - Components that already exist must be directories (or symbolic links to
+//     directories); otherwise the call fails with ENOTDIR. Concurrent creation
+//     of the same directories is tolerated.
+//
+// Dependencies:
+//   - POSIX: <fcntl.h> & openat/mkdirat, <pthread.h> for the cache
+//   - Windows: not supported, path_mkdirs() returns 0
+//
+// Example:
+// ----------------------------------------
+//   if (!path_mkdirs("/var/cache/app/objects/3f/a2", 0755, 0))
+//   {
+//       perror("path_mkdirs");
+//   }
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_hash.h" // For path_hash_append
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#ifndef _WIN32
+#   include <fcntl.h>    // For openat, mkdirat and O_* flags
+#   include <pthread.h>  // For the cache lock
+#   include <sys/stat.h> // For mkdirat and fstatat
+#endif
+
+// ============= MACROS =============
+#ifndef PATH_MKDIRS_MAX_DEPTH
+#   define PATH_MKDIRS_MAX_DEPTH 512 // Maximum number of components handled by path_mkdirs
+#endif
+
+#ifndef PATH_MKDIRS_CACHE_SIZE
+#   define PATH_MKDIRS_CACHE_SIZE 4096 // Slots of the known-directory cache (a power of two)
+#endif
+
+#ifndef _WIN32
+#   ifdef O_PATH
+#       define __FLUENT_LIBC_PATH_MKDIRS_OPEN (O_PATH | O_DIRECTORY | O_CLOEXEC)
+#   else
+#       define __FLUENT_LIBC_PATH_MKDIRS_OPEN (O_RDONLY | O_DIRECTORY | O_CLOEXEC)
+#   endif
+#endif
+
+// ============= TYPES =============
+/**
+ * @brief Options for path_mkdirs().
+ */
+typedef enum
+{
+    PATH_MKDIRS_NO_CACHE = 1 << 0, // Neither read nor update the known-directory cache
+} path_mkdirs_flags_t;
+
+/**
+ * @brief The normalized form of the path given to path_mkdirs().
+ */
+typedef struct
+{
+    char path[FLUENT_LIBC_PATH_MAX];         // Components joined by single separators
+    size_t ends[PATH_MKDIRS_MAX_DEPTH];      // End offset of each component in path
+    size_t starts[PATH_MKDIRS_MAX_DEPTH];    // Start offset of each component in path
+    uint64_t hashes[PATH_MKDIRS_MAX_DEPTH];  // Hash of each prefix (absolute paths only)
+    size_t count;                            // Number of components
+    int absolute;                            // Non-zero for absolute paths
+} __fluent_libc_path_mkdirs_t;
+
+// ============= GLOBALS =============
+#ifndef _WIN32
+#   if defined(FLUENT_LIBC_PATH_INLINE) && !defined(FLUENT_LIBC_PATH_IMPLEMENTATION)
+extern uint64_t __fluent_libc_path_mkdirs_cache[PATH_MKDIRS_CACHE_SIZE];
+extern pthread_mutex_t __fluent_libc_path_mkdirs_lock;
+#   else
+FLUENT_LIBC_PATH_DATA uint64_t __fluent_libc_path_mkdirs_cache[PATH_MKDIRS_CACHE_SIZE]; // Prefix hashes, 0 = empty
+FLUENT_LIBC_PATH_DATA pthread_mutex_t __fluent_libc_path_mkdirs_lock = PTHREAD_MUTEX_INITIALIZER;
+#   endif
+#endif
+
+// ============= HELPERS =============
+#ifndef _WIN32
+/**
+ * @brief Normalizes a path into components.
+ *
+ * @return 1 on success, 0 if the path is too long or too deep (errno set).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_mkdirs_split(const char *const path, __fluent_libc_path_mkdirs_t *const out)
+{
+    out->absolute = path[0] == PATH_SEPARATOR;
+    out->count = 0;
+    size_t len = 0;
+    if (out->absolute)
+    {
+        out->path[len++] = PATH_SEPARATOR;
+    }
+
+    uint64_t hash = path_hash_root(1);
+    const char *p = path;
+    while (*p)
+    {
+        while (*p == PATH_SEPARATOR)
+        {
+            p++;
+        }
+
+        const char *start = p;
+        while (*p && *p != PATH_SEPARATOR)
+        {
+            p++;
+        }
+
+        const size_t component = (size_t)(p - start);
+        if (component == 0 || (component == 1 && start[0] == '.'))
+        {
+            continue; // Trailing separator or "."
+        }
+
+        if (out->count == PATH_MKDIRS_MAX_DEPTH || len + component + 2 > sizeof(out->path))
+        {
+            errno = ENAMETOOLONG;
+            return 0; // Too deep or too long
+        }
+
+        if (out->count > 0)
+        {
+            out->path[len++] = PATH_SEPARATOR;
+        }
+        out->starts[out->count] = len;
+        memcpy(out->path + len, start, component);
+        len += component;
+        out->ends[out->count] = len;
+
+        hash = path_hash_append(hash, start, component);
+        out->hashes[out->count] = hash ? hash : 1; // 0 marks an empty cache slot
+        out->count++;
+    }
+
+    out->path[len] = '\0';
+    return 1;
+}
+
+/**
+ * @brief Opens the directory named by the first k components (k = 0 is the root or the cwd).
+ *
+ * @return The descriptor, or -1 with errno set.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_mkdirs_open(__fluent_libc_path_mkdirs_t *const dirs, const size_t k)
+{
+    if (k == 0)
+    {
+        return open(dirs->absolute ? "/" : ".", __FLUENT_LIBC_PATH_MKDIRS_OPEN);
+    }
+
+    // Terminate the prefix in place
+    const size_t end = dirs->ends[k - 1];
+    const char saved = dirs->path[end];
+    dirs->path[end] = '\0';
+    const int fd = open(dirs->path, __FLUENT_LIBC_PATH_MKDIRS_OPEN);
+    dirs->path[end] = saved;
+    return fd;
+}
+
+/**
+ * @brief Returns the number of leading components known to exist from the cache.
+ */
+FLUENT_LIBC_PATH_API size_t __fluent_libc_path_mkdirs_cached(const __fluent_libc_path_mkdirs_t *const dirs)
+{
+    size_t k = dirs->count;
+    pthread_mutex_lock(&__fluent_libc_path_mkdirs_lock);
+    while (k > 0 && __fluent_libc_path_mkdirs_cache[dirs->hashes[k - 1] & (PATH_MKDIRS_CACHE_SIZE - 1)] != dirs->hashes[k - 1])
+    {
+        k--;
+    }
+    pthread_mutex_unlock(&__fluent_libc_path_mkdirs_lock);
+    return k;
+}
+
+/**
+ * @brief Records that the first `upto` components exist.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_mkdirs_remember(const __fluent_libc_path_mkdirs_t *const dirs, const size_t upto)
+{
+    pthread_mutex_lock(&__fluent_libc_path_mkdirs_lock);
+    for (size_t i = 0; i < upto; i++)
+    {
+        __fluent_libc_path_mkdirs_cache[dirs->hashes[i] & (PATH_MKDIRS_CACHE_SIZE - 1)] = dirs->hashes[i];
+    }
+    pthread_mutex_unlock(&__fluent_libc_path_mkdirs_lock);
+}
+
+/**
+ * @brief Finds the deepest existing ancestor, then creates the missing components.
+ *
+ * @param dirs The normalized path.
+ * @param mode The mode of the created directories.
+ * @param known Number of leading components known to exist (from the cache).
+ * @return 1 on success, 0 on failure with errno set.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_mkdirs_run(
+    __fluent_libc_path_mkdirs_t *const dirs,
+    const mode_t mode,
+    const size_t known
+)
+{
+    const size_t n = dirs->count;
+
+    // Common case first: the leaf already exists (checked even when cached: it may have been removed)
+    int fd = __fluent_libc_path_mkdirs_open(dirs, n);
+    if (fd >= 0)
+    {
+        close(fd);
+        return 1;
+    }
+
+    if (errno != ENOENT || known == n)
+    {
+        return 0; // ENOTDIR, EACCES, ELOOP, ... or a cached leaf that was removed (ENOENT)
+    }
+
+    // Binary search for the deepest existing prefix in [known, n - 1]
+    size_t lo = known;
+    size_t hi = n - 1;
+    fd = -1;
+    while (lo < hi)
+    {
+        const size_t mid = lo + (hi - lo + 1) / 2;
+        const int probe = __fluent_libc_path_mkdirs_open(dirs, mid);
+        if (probe >= 0)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+            fd = probe;
+            lo = mid;
+        }
+        else if (errno == ENOENT)
+        {
+            hi = mid - 1;
+        }
+        else
+        {
+            const int saved = errno;
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+            errno = saved;
+            return 0; // A component exists but is not a usable directory
+        }
+    }
+
+    // lo is the deepest existing prefix; open it unless the search already did
+    if (fd < 0)
+    {
+        fd = __fluent_libc_path_mkdirs_open(dirs, lo);
+        if (fd < 0)
+        {
+            return 0; // The ancestor vanished (or a cached one was removed)
+        }
+    }
+
+    // Create the missing suffix, each relative to its parent's descriptor
+    for (size_t i = lo; i < n; i++)
+    {
+        const size_t end = dirs->ends[i];
+        const char saved = dirs->path[end];
+        const char *name = dirs->path + dirs->starts[i];
+        dirs->path[end] = '\0';
+
+        const int made = mkdirat(fd, name, mode) == 0;
+        const int existed = !made && errno == EEXIST; // Created concurrently, or not a directory
+        int ok = made || existed;
+        int next = -1;
+        if (ok && i + 1 < n)
+        {
+            next = openat(fd, name, __FLUENT_LIBC_PATH_MKDIRS_OPEN);
+            ok = next >= 0;
+        }
+        else if (existed)
+        {
+            struct stat st;
+            ok = fstatat(fd, name, &st, 0) == 0 && S_ISDIR(st.st_mode);
+            if (!ok && errno == EEXIST)
+            {
+                errno = ENOTDIR; // The leaf exists but is not a directory
+            }
+        }
+
+        dirs->path[end] = saved;
+        const int error = errno;
+        close(fd);
+        if (!ok)
+        {
+            errno = error;
+            return 0; // mkdirat or openat failed
+        }
+
+        fd = next;
+    }
+
+    return 1;
+}
+#endif
+
+// ============= PUBLIC API =============
+/**
+ * @brief Forgets every directory remembered by path_mkdirs().
+ */
+FLUENT_LIBC_PATH_API void path_mkdirs_cache_clear(void)
+{
+#ifndef _WIN32
+    pthread_mutex_lock(&__fluent_libc_path_mkdirs_lock);
+    memset(__fluent_libc_path_mkdirs_cache, 0, sizeof(__fluent_libc_path_mkdirs_cache));
+    pthread_mutex_unlock(&__fluent_libc_path_mkdirs_lock);
+#endif
+}
+
+/**
+ * @brief Creates a directory and every missing parent (mkdir -p).
+ *
+ * @param path The directory to create. Must not be NULL or empty.
+ * @param mode The mode of the created directories (before the umask).
+ * @param flags A combination of path_mkdirs_flags_t values.
+ * @return 1 if the directory exists when the call returns, 0 on failure with errno set.
+ */
+FLUENT_LIBC_PATH_API int path_mkdirs(const char *const path, const mode_t mode, const int flags)
+{
+    if (!path || path[0] == '\0')
+    {
+        errno = EINVAL;
+        return 0; // Invalid path
+    }
+
+#ifdef _WIN32
+    (void)mode;
+    (void)flags;
+    return 0; // Not supported on Windows
+#else
+    __fluent_libc_path_mkdirs_t dirs;
+    if (!__fluent_libc_path_mkdirs_split(path, &dirs))
+    {
+        return 0; // Too long or too deep
+    }
+
+    // Only absolute paths are cached: relative ones depend on the cwd
+    const int cached = dirs.absolute && !(flags & PATH_MKDIRS_NO_CACHE);
+    const size_t known = cached ? __fluent_libc_path_mkdirs_cached(&dirs) : 0;
+
+    int result = __fluent_libc_path_mkdirs_run(&dirs, mode, known);
+    if (!result && known > 0 && errno == ENOENT)
+    {
+        path_mkdirs_cache_clear(); // A cached directory was removed: start over from the root
+        result = __fluent_libc_path_mkdirs_run(&dirs, mode, 0);
+    }
+
+    if (result && cached)
+    {
+        __fluent_libc_path_mkdirs_remember(&dirs, dirs.count);
+    }
+
+    return result;
+#endif
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_MKDIRS_LIBRARY_H
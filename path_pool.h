@@ -0,0 +1,604 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_POOL_LIBRARY_H
+#define FLUENT_LIBC_PATH_POOL_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Work-Stealing Thread Pool (internal)
+// ----------------------------------------
+// The thread pool behind path_walk_parallel(), path_remove_tree() and path_tree_stats().
+// Provides:
+//   - __fluent_libc_path_pool_init(pool, threads, process, idle, discard, data) – Sets up the workers
+//   - __fluent_libc_path_pool_push(pool, worker, item)                          – Queues an item
+//   - __fluent_libc_path_pool_start(pool) / __fluent_libc_path_pool_join(pool, n) – Runs it on new threads
+//   - __fluent_libc_path_pool_run(pool)                                         – Runs it with the calling thread as worker 0
+//   - __fluent_libc_path_pool_destroy(pool)                                     – Discards leftovers, frees the pool
+//
+// Behavior:
+//   - Every worker owns a work-stealing (Chase-Lev) deque. A worker pops its
+//     own deque LIFO (depth-first, cache friendly) and steals FIFO from random
+//     victims when it runs dry, so large subtrees spread out. Items pushed
+//     while processing go to the pushing worker's own deque, without locks.
+//   - A worker that finds nothing to steal sleeps on a condition variable
+//     until new work is pushed, the last item is done or the pool is stopped.
+//   - The pool is done when no item is queued or being processed.
+//
+// Dependencies:
+//   - POSIX threads and path_atomic.h
+//   - Windows: not available
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_atomic.h" // For the deques and counters
+#include <stdlib.h>
+#ifndef _WIN32
+#   include <pthread.h> // For the worker threads
+#   include <unistd.h>  // For sysconf
+#endif
+
+#ifndef _WIN32
+// ============= WORK-STEALING DEQUE =============
+/**
+ * @brief Circular storage of a Chase-Lev deque.
+ */
+typedef struct __fluent_libc_path_deque_array
+{
+    struct __fluent_libc_path_deque_array *retired; // Smaller array this one replaced
+    long cap;                                       // Number of slots (power of two)
+    void *slots[];                                  // Item slots (atomic)
+} __fluent_libc_path_deque_array_t;
+
+/**
+ * @brief A Chase-Lev work-stealing deque.
+ *
+ * The owner pushes and takes at the bottom; thieves steal from the top.
+ * Retired arrays are kept until the deque is destroyed, since a thief may
+ * still be reading from them.
+ */
+typedef struct
+{
+    long top;                                // Next slot thieves steal from (atomic)
+    long bottom;                             // Next slot the owner pushes to (atomic)
+    __fluent_libc_path_deque_array_t *array; // Current storage (atomic)
+} __fluent_libc_path_deque_t;
+
+/**
+ * @brief Allocates deque storage with the given number of slots.
+ */
+FLUENT_LIBC_PATH_API __fluent_libc_path_deque_array_t *__fluent_libc_path_deque_array_new(const long cap)
+{
+    __fluent_libc_path_deque_array_t *array = (__fluent_libc_path_deque_array_t *)malloc(
+        sizeof(__fluent_libc_path_deque_array_t) + (size_t)cap * sizeof(void *)
+    );
+    if (!array)
+    {
+        return NULL; // Memory allocation failed
+    }
+
+    array->retired = NULL;
+    array->cap = cap;
+    return array;
+}
+
+/**
+ * @brief Initializes an empty deque.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_deque_init(__fluent_libc_path_deque_t *const deque)
+{
+    __fluent_libc_path_deque_array_t *array = __fluent_libc_path_deque_array_new(256);
+    if (!array)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&deque->top, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&deque->bottom, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&deque->array, array, __ATOMIC_RELAXED);
+    return 1;
+}
+
+/**
+ * @brief Frees a deque's current and retired storage.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_deque_destroy(__fluent_libc_path_deque_t *const deque)
+{
+    __fluent_libc_path_deque_array_t *array = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->array, __ATOMIC_RELAXED);
+    while (array)
+    {
+        __fluent_libc_path_deque_array_t *retired = array->retired;
+        free(array);
+        array = retired;
+    }
+}
+
+/**
+ * @brief Pushes an item at the bottom of the deque. Owner only.
+ *
+ * @return 1 on success, 0 if the deque needed to grow and memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_deque_push(__fluent_libc_path_deque_t *const deque, void *const item)
+{
+    const long b = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->bottom, __ATOMIC_RELAXED);
+    const long t = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->top, __ATOMIC_ACQUIRE);
+    __fluent_libc_path_deque_array_t *array = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->array, __ATOMIC_RELAXED);
+
+    // Double the storage once it is full
+    if (b - t > array->cap - 1)
+    {
+        __fluent_libc_path_deque_array_t *grown = __fluent_libc_path_deque_array_new(array->cap * 2);
+        if (!grown)
+        {
+            return 0; // Memory allocation failed
+        }
+
+        for (long i = t; i < b; i++)
+        {
+            __FLUENT_LIBC_PATH_ATOMIC_STORE(
+                &grown->slots[i & (grown->cap - 1)],
+                __FLUENT_LIBC_PATH_ATOMIC_LOAD(&array->slots[i & (array->cap - 1)], __ATOMIC_RELAXED),
+                __ATOMIC_RELAXED
+            );
+        }
+
+        grown->retired = array;
+        __FLUENT_LIBC_PATH_ATOMIC_STORE(&deque->array, grown, __ATOMIC_RELEASE);
+        array = grown;
+    }
+
+    // Publishing bottom with release makes the item (and what it points to) visible to thieves
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&array->slots[b & (array->cap - 1)], item, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&deque->bottom, b + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+/**
+ * @brief Takes the most recently pushed item from the bottom of the deque. Owner only.
+ *
+ * @return The item, or NULL if the deque is empty.
+ */
+FLUENT_LIBC_PATH_API void *__fluent_libc_path_deque_take(__fluent_libc_path_deque_t *const deque)
+{
+    const long b = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->bottom, __ATOMIC_RELAXED) - 1;
+    __fluent_libc_path_deque_array_t *array = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->array, __ATOMIC_RELAXED);
+    // The store to bottom must not be reordered after the load of top
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&deque->bottom, b, __ATOMIC_SEQ_CST);
+    long t = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->top, __ATOMIC_SEQ_CST);
+
+    // The deque was already empty
+    if (t > b)
+    {
+        __FLUENT_LIBC_PATH_ATOMIC_STORE(&deque->bottom, b + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    void *item = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&array->slots[b & (array->cap - 1)], __ATOMIC_RELAXED);
+    if (t == b)
+    {
+        // Last item: race the thieves for it
+        if (!__FLUENT_LIBC_PATH_ATOMIC_CAS(
+            &deque->top, &t, t + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+        {
+            item = NULL; // A thief won
+        }
+        __FLUENT_LIBC_PATH_ATOMIC_STORE(&deque->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+
+    return item;
+}
+
+/**
+ * @brief Steals the oldest item from the top of the deque. Any thread.
+ *
+ * @return The item, or NULL if the deque is empty or the steal lost a race.
+ */
+FLUENT_LIBC_PATH_API void *__fluent_libc_path_deque_steal(__fluent_libc_path_deque_t *const deque)
+{
+    long t = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->top, __ATOMIC_SEQ_CST);
+    const long b = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->bottom, __ATOMIC_SEQ_CST);
+
+    if (t >= b)
+    {
+        return NULL; // Nothing to steal
+    }
+
+    __fluent_libc_path_deque_array_t *array = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&deque->array, __ATOMIC_ACQUIRE);
+    void *item = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&array->slots[t & (array->cap - 1)], __ATOMIC_RELAXED);
+    if (!__FLUENT_LIBC_PATH_ATOMIC_CAS(
+        &deque->top, &t, t + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+    {
+        return NULL; // Lost the race against the owner or another thief
+    }
+
+    return item;
+}
+
+// ============= THREAD POOL =============
+typedef struct __fluent_libc_path_pool __fluent_libc_path_pool_t;
+
+/**
+ * @brief Processes one work item on a worker thread.
+ */
+typedef void (*__fluent_libc_path_pool_fn_t)(__fluent_libc_path_pool_t *pool, size_t worker, void *item);
+
+/**
+ * @brief Called when a worker finds no work (before it blocks), and once more before it exits.
+ */
+typedef void (*__fluent_libc_path_pool_idle_fn_t)(__fluent_libc_path_pool_t *pool, size_t worker);
+
+/**
+ * @brief Releases a work item that was never processed because the pool stopped.
+ */
+typedef void (*__fluent_libc_path_pool_discard_fn_t)(__fluent_libc_path_pool_t *pool, void *item);
+
+/**
+ * @brief Per-worker bookkeeping.
+ */
+typedef struct
+{
+    __fluent_libc_path_pool_t *pool;  // Owning pool
+    size_t index;                     // Worker index
+    __fluent_libc_path_deque_t deque; // Pending work owned by this worker
+    unsigned int seed;                // Victim selection state
+    pthread_t thread;                 // Worker thread
+} __fluent_libc_path_pool_worker_t;
+
+/**
+ * @brief A fixed-size pool of work-stealing workers.
+ */
+struct __fluent_libc_path_pool
+{
+    __fluent_libc_path_pool_worker_t *workers;    // Worker array
+    size_t threads;                               // Number of workers
+    size_t pending;                               // Items pushed but not yet fully processed (atomic)
+    size_t running;                               // Workers that have not exited yet (atomic)
+    int stop;                                     // Set to abort the pool (atomic)
+    size_t epoch;                                 // Bumped on every push, so idle workers notice new work (atomic)
+    size_t sleepers;                              // Workers blocked waiting for work (atomic)
+    pthread_mutex_t lock;                         // Guards the condition variables
+    pthread_cond_t wake;                          // Wakes idle workers (new work, work finished, stop)
+    pthread_cond_t owner;                         // Wakes the thread driving the pool (a worker exited, or a hook asked)
+    __fluent_libc_path_pool_fn_t process;         // Item handler
+    __fluent_libc_path_pool_idle_fn_t idle;       // Idle hook (may be NULL)
+    __fluent_libc_path_pool_discard_fn_t discard; // Discard hook (may be NULL)
+    void *user_data;                              // Opaque state for the hooks
+};
+
+/**
+ * @brief Resolves a requested thread count, using the online CPU count for 0.
+ */
+FLUENT_LIBC_PATH_API size_t __fluent_libc_path_pool_threads(const size_t threads)
+{
+    if (threads > 0)
+    {
+        return threads;
+    }
+
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (size_t)cpus : 1;
+}
+
+/**
+ * @brief Initializes a pool. Threads are not started yet.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_pool_init(
+    __fluent_libc_path_pool_t *const pool,
+    const size_t threads,
+    const __fluent_libc_path_pool_fn_t process,
+    const __fluent_libc_path_pool_idle_fn_t idle,
+    const __fluent_libc_path_pool_discard_fn_t discard,
+    void *const user_data
+)
+{
+    pool->threads = __fluent_libc_path_pool_threads(threads);
+    pool->workers = (__fluent_libc_path_pool_worker_t *)calloc(pool->threads, sizeof(__fluent_libc_path_pool_worker_t));
+    if (!pool->workers)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    for (size_t i = 0; i < pool->threads; i++)
+    {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        pool->workers[i].seed = (unsigned int)(i * 2654435761u + 1);
+        if (!__fluent_libc_path_deque_init(&pool->workers[i].deque))
+        {
+            for (size_t j = 0; j < i; j++)
+            {
+                __fluent_libc_path_deque_destroy(&pool->workers[j].deque);
+            }
+            free(pool->workers);
+            return 0; // Memory allocation failed
+        }
+    }
+
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&pool->pending, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&pool->running, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&pool->stop, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&pool->epoch, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&pool->sleepers, 0, __ATOMIC_RELAXED);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->owner, NULL);
+    pool->process = process;
+    pool->idle = idle;
+    pool->discard = discard;
+    pool->user_data = user_data;
+    return 1;
+}
+
+/**
+ * @brief Wakes every idle worker so it re-checks for work.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_pool_wake(__fluent_libc_path_pool_t *const pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * @brief Wakes the thread waiting on the pool's owner condition.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_pool_notify(__fluent_libc_path_pool_t *const pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_broadcast(&pool->owner);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * @brief Aborts the pool: workers stop taking items and exit.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_pool_stop(__fluent_libc_path_pool_t *const pool)
+{
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&pool->stop, 1, __ATOMIC_SEQ_CST);
+    __fluent_libc_path_pool_wake(pool);
+}
+
+/**
+ * @brief Queues an item on a worker's deque.
+ *
+ * Must be called from that worker's thread, or before the pool is started.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_pool_push(__fluent_libc_path_pool_t *const pool, const size_t worker, void *const item)
+{
+    __FLUENT_LIBC_PATH_ATOMIC_ADD(&pool->pending, 1, __ATOMIC_RELAXED);
+    if (!__fluent_libc_path_deque_push(&pool->workers[worker].deque, item))
+    {
+        __FLUENT_LIBC_PATH_ATOMIC_SUB(&pool->pending, 1, __ATOMIC_RELAXED);
+        return 0; // Memory allocation failed
+    }
+
+    // Bumping the epoch before reading sleepers pairs with __fluent_libc_path_pool_wait(),
+    // which registers as a sleeper before re-reading the epoch: one of the two sees the other
+    __FLUENT_LIBC_PATH_ATOMIC_ADD(&pool->epoch, 1, __ATOMIC_SEQ_CST);
+    if (__FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool->sleepers, __ATOMIC_SEQ_CST) > 0)
+    {
+        __fluent_libc_path_pool_wake(pool);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Finds the next item for a worker: its own deque first, then a random victim's.
+ */
+FLUENT_LIBC_PATH_API void *__fluent_libc_path_pool_find(__fluent_libc_path_pool_worker_t *const self)
+{
+    void *item = __fluent_libc_path_deque_take(&self->deque);
+    if (item)
+    {
+        return item;
+    }
+
+    // Try every other worker once, starting from a random one
+    __fluent_libc_path_pool_t *pool = self->pool;
+    self->seed = self->seed * 1103515245u + 12345u;
+    const size_t start = (size_t)(self->seed >> 8);
+    for (size_t i = 0; i < pool->threads; i++)
+    {
+        const size_t victim = (start + i) % pool->threads;
+        if (victim == self->index)
+        {
+            continue;
+        }
+
+        item = __fluent_libc_path_deque_steal(&pool->workers[victim].deque);
+        if (item)
+        {
+            return item;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Blocks an idle worker until an item is pushed after the given epoch, the work is done or the pool stops.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_pool_wait(__fluent_libc_path_pool_t *const pool, const size_t epoch)
+{
+    pthread_mutex_lock(&pool->lock);
+    __FLUENT_LIBC_PATH_ATOMIC_ADD(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+    while (__FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool->epoch, __ATOMIC_SEQ_CST) == epoch &&
+           __FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool->pending, __ATOMIC_SEQ_CST) > 0 &&
+           !__FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool->stop, __ATOMIC_SEQ_CST))
+    {
+        pthread_cond_wait(&pool->wake, &pool->lock);
+    }
+    __FLUENT_LIBC_PATH_ATOMIC_SUB(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * @brief Main loop of a worker thread.
+ */
+FLUENT_LIBC_PATH_API void *__fluent_libc_path_pool_main(void *const arg)
+{
+    __fluent_libc_path_pool_worker_t *self = (__fluent_libc_path_pool_worker_t *)arg;
+    __fluent_libc_path_pool_t *pool = self->pool;
+
+    while (!__FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool->stop, __ATOMIC_RELAXED))
+    {
+        // Read the epoch first: anything pushed after this point wakes the wait below
+        const size_t epoch = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool->epoch, __ATOMIC_SEQ_CST);
+        void *item = __fluent_libc_path_pool_find(self);
+        if (item)
+        {
+            pool->process(pool, self->index, item);
+            if (__FLUENT_LIBC_PATH_ATOMIC_SUB(&pool->pending, 1, __ATOMIC_ACQ_REL) == 1)
+            {
+                __fluent_libc_path_pool_wake(pool); // That was the last item: release the idle workers
+            }
+            continue;
+        }
+
+        // No work anywhere and nothing in flight: the traversal is complete
+        if (__FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool->pending, __ATOMIC_ACQUIRE) == 0)
+        {
+            break;
+        }
+
+        // Others are still producing work; flush local state and sleep until they push some
+        if (pool->idle)
+        {
+            pool->idle(pool, self->index);
+        }
+        __fluent_libc_path_pool_wait(pool, epoch);
+    }
+
+    // Final flush before exiting
+    if (pool->idle)
+    {
+        pool->idle(pool, self->index);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    __FLUENT_LIBC_PATH_ATOMIC_SUB(&pool->running, 1, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&pool->owner);
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/**
+ * @brief Starts the worker threads.
+ *
+ * @return The number of threads actually started.
+ */
+FLUENT_LIBC_PATH_API size_t __fluent_libc_path_pool_start(__fluent_libc_path_pool_t *const pool)
+{
+    size_t started = 0;
+    for (size_t i = 0; i < pool->threads; i++)
+    {
+        __FLUENT_LIBC_PATH_ATOMIC_ADD(&pool->running, 1, __ATOMIC_RELAXED);
+        if (pthread_create(&pool->workers[i].thread, NULL, __fluent_libc_path_pool_main, &pool->workers[i]) != 0)
+        {
+            __FLUENT_LIBC_PATH_ATOMIC_SUB(&pool->running, 1, __ATOMIC_RELAXED);
+            break; // Run with the threads we could start; idle deques are simply never filled
+        }
+        started++;
+    }
+
+    return started;
+}
+
+/**
+ * @brief Discards leftover items and frees the pool. Every worker must have exited.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_pool_destroy(__fluent_libc_path_pool_t *const pool)
+{
+    // Release items left behind when the pool was stopped early
+    for (size_t i = 0; i < pool->threads; i++)
+    {
+        void *item;
+        while ((item = __fluent_libc_path_deque_take(&pool->workers[i].deque)) != NULL)
+        {
+            if (pool->discard)
+            {
+                pool->discard(pool, item);
+            }
+        }
+        __fluent_libc_path_deque_destroy(&pool->workers[i].deque);
+    }
+
+    pthread_cond_destroy(&pool->owner);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    pool->workers = NULL;
+}
+
+/**
+ * @brief Waits for every worker, then destroys the pool.
+ *
+ * @param pool The pool to join.
+ * @param started The value returned by __fluent_libc_path_pool_start().
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_pool_join(__fluent_libc_path_pool_t *const pool, const size_t started)
+{
+    for (size_t i = 0; i < started; i++)
+    {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    __fluent_libc_path_pool_destroy(pool);
+}
+
+/**
+ * @brief Runs the pool until its work is done, with the calling thread as worker 0.
+ *
+ * The other workers get their own threads; if some cannot be started, the
+ * ones that did (at least the calling thread) take over their share.
+ * The pool must still be destroyed afterwards.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_pool_run(__fluent_libc_path_pool_t *const pool)
+{
+    __FLUENT_LIBC_PATH_ATOMIC_ADD(&pool->running, 1, __ATOMIC_RELAXED); // The calling thread
+    size_t started = 1;
+    while (started < pool->threads)
+    {
+        __FLUENT_LIBC_PATH_ATOMIC_ADD(&pool->running, 1, __ATOMIC_RELAXED);
+        if (pthread_create(&pool->workers[started].thread, NULL, __fluent_libc_path_pool_main, &pool->workers[started]) != 0)
+        {
+            __FLUENT_LIBC_PATH_ATOMIC_SUB(&pool->running, 1, __ATOMIC_RELAXED);
+            break;
+        }
+        started++;
+    }
+
+    __fluent_libc_path_pool_main(&pool->workers[0]);
+    for (size_t i = 1; i < started; i++)
+    {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+}
+#endif
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_POOL_LIBRARY_H
@@ -0,0 +1,266 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_PROBE_LIBRARY_H
+#define FLUENT_LIBC_PATH_PROBE_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Existence and Type Probes
+// ----------------------------------------
+// Answers "does it exist / what is it" without canonicalizing the path.
+// Provides:
+//   - path_exists(path)                     – 1 if the path names an existing entry
+//   - path_is_dir(path)                     – 1 if it is a directory
+//   - path_is_file(path)                    – 1 if it is a regular file
+//   - path_exists_batch(paths, n, out)      – Same over an array; returns the number of hits
+//   - path_is_dir_batch(paths, n, out)
+//   - path_is_file_batch(paths, n, out)
+//
+// Behavior:
+//   - One statx() per path, asking only for STATX_TYPE with AT_STATX_DONT_SYNC,
+//     so network filesystems answer from their cache. Using get_real_path_buff()
+//     as an existence test costs a readlink per component instead.
+//   - Symbolic links are followed, as stat() does: a dangling link does not exist.
+//   - Kernels without statx (or sandboxes that block it) fall back to stat();
+//     other POSIX systems use stat(), Windows uses GetFileAttributesA.
+//   - On failure errno is left as set by the failing call.
+//
+// Memory Management:
+//   - No allocation. Batch results are written to a caller array of n bytes
+//     (1 for a hit, 0 otherwise); out may be NULL to only count.
+//
+// Example:
+// ----------------------------------------
+//   if (path_is_file("config.toml")) { load("config.toml"); }
+//
+//   unsigned char found[3];
+//   const char *candidates[] = { "a.conf", "b.conf", "c.conf" };
+//   size_t hits = path_exists_batch(candidates, 3, found);
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include <errno.h>
+#ifdef __linux__
+#   include "path_resolve.h" // For __fluent_libc_path_statx
+#endif
+#ifndef _WIN32
+#   include <fcntl.h>    // For AT_FDCWD
+#   include <sys/stat.h> // For stat and S_IS*
+#endif
+
+// ============= MACROS =============
+#ifdef __linux__
+#   ifndef AT_STATX_DONT_SYNC
+#       define AT_STATX_DONT_SYNC 0x4000 // Do not revalidate cached attributes (NFS, FUSE, ...)
+#   endif
+#endif
+
+#define __FLUENT_LIBC_PATH_PROBE_NONE 0  // Does not exist (or cannot be probed)
+#define __FLUENT_LIBC_PATH_PROBE_FILE 1  // Regular file
+#define __FLUENT_LIBC_PATH_PROBE_DIR 2   // Directory
+#define __FLUENT_LIBC_PATH_PROBE_OTHER 3 // Any other type
+
+// ============= GLOBALS =============
+#ifdef __linux__
+#   if defined(FLUENT_LIBC_PATH_INLINE) && !defined(FLUENT_LIBC_PATH_IMPLEMENTATION)
+extern int __fluent_libc_path_probe_no_statx;
+#   else
+FLUENT_LIBC_PATH_DATA int __fluent_libc_path_probe_no_statx = 0; // Set once statx() reports ENOSYS
+#   endif
+#endif
+
+// ============= HELPERS =============
+#ifndef _WIN32
+/**
+ * @brief Maps a st_mode / stx_mode value to a __FLUENT_LIBC_PATH_PROBE_* value.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_probe_mode(const mode_t mode)
+{
+    if (S_ISREG(mode))
+    {
+        return __FLUENT_LIBC_PATH_PROBE_FILE;
+    }
+
+    return S_ISDIR(mode) ? __FLUENT_LIBC_PATH_PROBE_DIR : __FLUENT_LIBC_PATH_PROBE_OTHER;
+}
+#endif
+
+/**
+ * @brief Classifies a path with a single metadata lookup.
+ *
+ * @param path The path. Must not be NULL.
+ * @return One of the __FLUENT_LIBC_PATH_PROBE_* values.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_probe(const char *const path)
+{
+    if (path[0] == '\0')
+    {
+        errno = ENOENT;
+        return __FLUENT_LIBC_PATH_PROBE_NONE; // Empty path
+    }
+
+#if defined(_WIN32)
+#   ifdef FLUENT_LIBC_NO_WINDOWS_SDK
+    return __FLUENT_LIBC_PATH_PROBE_NONE; // If Windows SDK is not included, we cannot probe paths
+#   else
+    const DWORD attributes = GetFileAttributesA(path);
+    if (attributes == INVALID_FILE_ATTRIBUTES)
+    {
+        return __FLUENT_LIBC_PATH_PROBE_NONE; // Does not exist
+    }
+
+    return (attributes & FILE_ATTRIBUTE_DIRECTORY) ? __FLUENT_LIBC_PATH_PROBE_DIR : __FLUENT_LIBC_PATH_PROBE_FILE;
+#   endif
+#else
+#   ifdef __linux__
+    if (!__fluent_libc_path_probe_no_statx)
+    {
+        struct statx st;
+        if (__fluent_libc_path_statx(AT_FDCWD, path, AT_STATX_DONT_SYNC, STATX_TYPE, &st) == 0)
+        {
+            return __fluent_libc_path_probe_mode(st.stx_mode);
+        }
+
+        if (errno != ENOSYS)
+        {
+            return __FLUENT_LIBC_PATH_PROBE_NONE; // Does not exist
+        }
+
+        __fluent_libc_path_probe_no_statx = 1; // Old kernel or seccomp filter: use stat() from now on
+    }
+#   endif
+
+    struct stat st;
+    if (stat(path, &st) != 0)
+    {
+        return __FLUENT_LIBC_PATH_PROBE_NONE; // Does not exist
+    }
+
+    return __fluent_libc_path_probe_mode(st.st_mode);
+#endif
+}
+
+/**
+ * @brief Probes an array of paths.
+ *
+ * @param paths The paths. NULL entries count as missing.
+ * @param n The number of paths.
+ * @param out Receives 1 or 0 per path (may be NULL).
+ * @param want The type to match, or __FLUENT_LIBC_PATH_PROBE_NONE for any existing entry.
+ * @return The number of matching paths.
+ */
+FLUENT_LIBC_PATH_API size_t __fluent_libc_path_probe_batch(
+    const char *const *const paths,
+    const size_t n,
+    unsigned char *const out,
+    const int want
+)
+{
+    size_t hits = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const int type = paths[i] ? __fluent_libc_path_probe(paths[i]) : __FLUENT_LIBC_PATH_PROBE_NONE;
+        const int hit = want == __FLUENT_LIBC_PATH_PROBE_NONE ? type != __FLUENT_LIBC_PATH_PROBE_NONE : type == want;
+        if (out)
+        {
+            out[i] = (unsigned char)hit;
+        }
+        hits += (size_t)hit;
+    }
+
+    return hits;
+}
+
+// ============= PUBLIC API =============
+/**
+ * @brief Checks whether a path names an existing entry (following symbolic links).
+ *
+ * @param path The path to probe.
+ * @return 1 if it exists, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int path_exists(const char *const path)
+{
+    return path && __fluent_libc_path_probe(path) != __FLUENT_LIBC_PATH_PROBE_NONE;
+}
+
+/**
+ * @brief Checks whether a path names a directory (following symbolic links).
+ *
+ * @param path The path to probe.
+ * @return 1 if it is a directory, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int path_is_dir(const char *const path)
+{
+    return path && __fluent_libc_path_probe(path) == __FLUENT_LIBC_PATH_PROBE_DIR;
+}
+
+/**
+ * @brief Checks whether a path names a regular file (following symbolic links).
+ *
+ * @param path The path to probe.
+ * @return 1 if it is a regular file, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int path_is_file(const char *const path)
+{
+    return path && __fluent_libc_path_probe(path) == __FLUENT_LIBC_PATH_PROBE_FILE;
+}
+
+/**
+ * @brief Runs path_exists() over an array of paths.
+ *
+ * @param paths The paths. NULL entries count as missing.
+ * @param n The number of paths.
+ * @param out Receives 1 or 0 per path (may be NULL to only count).
+ * @return The number of existing paths.
+ */
+FLUENT_LIBC_PATH_API size_t path_exists_batch(const char *const *const paths, const size_t n, unsigned char *const out)
+{
+    return __fluent_libc_path_probe_batch(paths, n, out, __FLUENT_LIBC_PATH_PROBE_NONE);
+}
+
+/**
+ * @brief Runs path_is_dir() over an array of paths.
+ *
+ * @param paths The paths. NULL entries count as missing.
+ * @param n The number of paths.
+ * @param out Receives 1 or 0 per path (may be NULL to only count).
+ * @return The number of directories.
+ */
+FLUENT_LIBC_PATH_API size_t path_is_dir_batch(const char *const *const paths, const size_t n, unsigned char *const out)
+{
+    return __fluent_libc_path_probe_batch(paths, n, out, __FLUENT_LIBC_PATH_PROBE_DIR);
+}
+
+/**
+ * @brief Runs path_is_file() over an array of paths.
+ *
+ * @param paths The paths. NULL entries count as missing.
+ * @param n The number of paths.
+ * @param out Receives 1 or 0 per path (may be NULL to only count).
+ * @return The number of regular files.
+ */
+FLUENT_LIBC_PATH_API size_t path_is_file_batch(const char *const *const paths, const size_t n, unsigned char *const out)
+{
+    return __fluent_libc_path_probe_batch(paths, n, out, __FLUENT_LIBC_PATH_PROBE_FILE);
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_PROBE_LIBRARY_H
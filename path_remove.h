@@ -0,0 +1,365 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_REMOVE_LIBRARY_H
+#define FLUENT_LIBC_PATH_REMOVE_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Parallel Recursive Removal
+// ----------------------------------------
+// rm -rf across a thread pool, working on directory fds instead of path strings.
+// Provides:
+//   - path_remove_tree(path, threads) – Removes path and everything below it
+//
+// Behavior:
+//   - Every directory is opened with openat() relative to its parent's fd and
+//     read with the path_walk.h directory reader (getdents64 on Linux). Files
+//     are removed with unlinkat(dirfd, name, 0) as they are read, and
+//     subdirectories are handed to the work-stealing pool of path_pool.h (the
+//     calling thread included), so independent subtrees are emptied in parallel.
+//   - A directory keeps its fd open and counts the subdirectories it is waiting
+//     for; the worker that finishes the last one removes it with
+//     unlinkat(parent_fd, name, AT_REMOVEDIR) and continues with the parent.
+//   - No path string is built per entry: only names are stored.
+//   - Symbolic links are removed, never followed. A root that is not a
+//     directory is simply unlinked; a missing root counts as removed.
+//   - A directory that is still not empty when it is removed (entries created
+//     concurrently) is scanned again, up to PATH_REMOVE_RETRIES times.
+//   - The filesystem root is refused (EPERM), as with rm --preserve-root.
+//   - Removal continues past errors; the first error is reported through errno.
+//
+// Dependencies:
+//   - POSIX: openat/unlinkat, path_walk.h, path_pool.h
+//   - Windows: not supported, path_remove_tree() returns 0
+//
+// Example:
+// ----------------------------------------
+//   if (!path_remove_tree("/tmp/build-sandbox", 0)) // 0: one thread per CPU
+//   {
+//       perror("path_remove_tree");
+//   }
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_atomic.h" // For the pending counters
+#include "path_pool.h"   // For the worker threads
+#include "path_walk.h"   // For path_dir_reader_t
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#   include <fcntl.h>       // For openat and O_* flags
+#   include <sys/stat.h>    // For fstatat
+#endif
+
+// ============= MACROS =============
+#ifndef PATH_REMOVE_RETRIES
+#   define PATH_REMOVE_RETRIES 3 // Rescans of a directory that is not empty when it should be
+#endif
+
+// ============= TYPES =============
+#ifndef _WIN32
+/**
+ * @brief A directory being removed.
+ */
+typedef struct __fluent_libc_path_remove_node
+{
+    struct __fluent_libc_path_remove_node *parent; // Containing directory (NULL for the root)
+    int fd;                                        // Open fd of this directory, -1 until it is opened
+    int attempts;                                  // Number of rescans so far
+    size_t pending;                                // 1 for its own scan + 1 per subdirectory not yet removed (atomic)
+    char name[];                                   // Name in the parent (the whole path for the root)
+} __fluent_libc_path_remove_node_t;
+
+/**
+ * @brief State shared by the workers of one path_remove_tree() call.
+ */
+typedef struct
+{
+    char *buffers; // One getdents64 buffer per worker
+    int error;     // First error (errno value), 0 if none (atomic)
+} __fluent_libc_path_remove_state_t;
+#endif
+
+// ============= HELPERS =============
+#ifndef _WIN32
+/**
+ * @brief Records an error; the first one is kept.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_remove_fail(__fluent_libc_path_remove_state_t *const state, const int error)
+{
+    int expected = 0;
+    __FLUENT_LIBC_PATH_ATOMIC_CAS(&state->error, &expected, error, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Allocates a node for a directory.
+ *
+ * @return The node, or NULL if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API __fluent_libc_path_remove_node_t *__fluent_libc_path_remove_node_new(
+    __fluent_libc_path_remove_node_t *const parent,
+    const char *const name,
+    const size_t len
+)
+{
+    __fluent_libc_path_remove_node_t *node =
+        (__fluent_libc_path_remove_node_t *)malloc(sizeof(__fluent_libc_path_remove_node_t) + len + 1);
+    if (!node)
+    {
+        return NULL; // Memory allocation failed
+    }
+
+    node->parent = parent;
+    node->fd = -1;
+    node->attempts = 0;
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&node->pending, 1, __ATOMIC_RELAXED);
+    memcpy(node->name, name, len);
+    node->name[len] = '\0';
+    return node;
+}
+
+/**
+ * @brief Drops one pending reference; removes the directory (and then its parents) when none are left.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_remove_release(
+    __fluent_libc_path_pool_t *const pool,
+    const size_t worker,
+    __fluent_libc_path_remove_node_t *node
+)
+{
+    __fluent_libc_path_remove_state_t *state = (__fluent_libc_path_remove_state_t *)pool->user_data;
+    while (node && __FLUENT_LIBC_PATH_ATOMIC_SUB(&node->pending, 1, __ATOMIC_ACQ_REL) == 1)
+    {
+        __fluent_libc_path_remove_node_t *parent = node->parent;
+        const int parent_fd = parent ? parent->fd : AT_FDCWD;
+        if (node->fd >= 0 && unlinkat(parent_fd, node->name, AT_REMOVEDIR) != 0 && errno != ENOENT)
+        {
+            if ((errno == ENOTEMPTY || errno == EEXIST) && node->attempts < PATH_REMOVE_RETRIES)
+            {
+                // Entries appeared while it was being emptied: scan it again
+                node->attempts++;
+                __FLUENT_LIBC_PATH_ATOMIC_STORE(&node->pending, 1, __ATOMIC_RELAXED);
+                if (__fluent_libc_path_pool_push(pool, worker, node))
+                {
+                    return;
+                }
+                errno = ENOMEM;
+            }
+
+            __fluent_libc_path_remove_fail(state, errno);
+        }
+
+        if (node->fd >= 0)
+        {
+            close(node->fd);
+        }
+        free(node);
+        node = parent;
+    }
+}
+
+/**
+ * @brief Pool process hook: empties one directory, unlinking its files and queueing its subdirectories.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_remove_scan(
+    __fluent_libc_path_pool_t *const pool,
+    const size_t worker,
+    void *const item
+)
+{
+    __fluent_libc_path_remove_state_t *state = (__fluent_libc_path_remove_state_t *)pool->user_data;
+    __fluent_libc_path_remove_node_t *node = (__fluent_libc_path_remove_node_t *)item;
+    char *buffer = state->buffers + worker * PATH_WALK_BUFFER_SIZE;
+
+    if (node->fd < 0)
+    {
+        const int parent_fd = node->parent ? node->parent->fd : AT_FDCWD;
+        node->fd = openat(parent_fd, node->name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+        if (node->fd < 0)
+        {
+            if (errno != ENOENT)
+            {
+                __fluent_libc_path_remove_fail(state, errno);
+            }
+            __fluent_libc_path_remove_release(pool, worker, node);
+            return; // Cannot be opened (or already gone)
+        }
+    }
+    else
+    {
+        lseek(node->fd, 0, SEEK_SET); // Rescan
+    }
+
+    // The reader owns the fd it is given; keep node->fd open for the children
+#ifdef __linux__
+    const int read_fd = node->fd;
+#else
+    const int read_fd = dup(node->fd);
+#endif
+    path_dir_reader_t reader;
+    if (read_fd < 0 || !path_dir_reader_open(&reader, read_fd, buffer, PATH_WALK_BUFFER_SIZE))
+    {
+        __fluent_libc_path_remove_fail(state, errno);
+        __fluent_libc_path_remove_release(pool, worker, node);
+        return; // Cannot be read
+    }
+
+    const char *name;
+    size_t name_len;
+    path_walk_type_t type;
+    int read;
+    while ((read = path_dir_reader_next(&reader, &name, &name_len, &type)) > 0)
+    {
+        if (type == PATH_WALK_TYPE_UNKNOWN)
+        {
+            struct stat st;
+            type = fstatat(node->fd, name, &st, AT_SYMLINK_NOFOLLOW) == 0 ? path_walk_type_from_mode(st.st_mode) : PATH_WALK_TYPE_UNKNOWN;
+        }
+
+        // Files, links and everything else: unlink right away
+        if (type != PATH_WALK_TYPE_DIR)
+        {
+            if (unlinkat(node->fd, name, 0) == 0 || errno == ENOENT)
+            {
+                continue;
+            }
+
+            // Linux reports EISDIR for a directory, POSIX allows EPERM; EPERM is also a real
+            // permission error (sticky directory, immutable file), so check which one it is
+            const int error = errno;
+            struct stat st;
+            if (error != EISDIR &&
+                (error != EPERM || fstatat(node->fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0 || !S_ISDIR(st.st_mode)))
+            {
+                __fluent_libc_path_remove_fail(state, error);
+                continue; // Cannot be removed
+            }
+            // A directory after all
+        }
+
+        __fluent_libc_path_remove_node_t *child = __fluent_libc_path_remove_node_new(node, name, name_len);
+        if (!child)
+        {
+            __fluent_libc_path_remove_fail(state, ENOMEM);
+            continue; // Memory allocation failed
+        }
+
+        __FLUENT_LIBC_PATH_ATOMIC_ADD(&node->pending, 1, __ATOMIC_RELAXED);
+        if (!__fluent_libc_path_pool_push(pool, worker, child))
+        {
+            __fluent_libc_path_remove_fail(state, ENOMEM);
+            __fluent_libc_path_remove_release(pool, worker, child); // Dropped: the parent will report ENOTEMPTY
+        }
+    }
+
+    if (read < 0)
+    {
+        __fluent_libc_path_remove_fail(state, errno);
+    }
+
+#ifndef __linux__
+    path_dir_reader_close(&reader);
+#endif
+
+    __fluent_libc_path_remove_release(pool, worker, node); // The scan itself is done
+}
+#endif
+
+// ============= PUBLIC API =============
+/**
+ * @brief Removes a file or a directory tree (rm -rf), spreading subtrees across threads.
+ *
+ * @param path The path to remove. Must not be NULL or empty.
+ * @param threads The number of worker threads, or 0 to use one per online CPU.
+ * @return 1 if the path no longer exists, 0 on failure with errno set to the first error.
+ */
+FLUENT_LIBC_PATH_API int path_remove_tree(const char *const path, const size_t threads)
+{
+    if (!path || path[0] == '\0')
+    {
+        errno = EINVAL;
+        return 0; // Invalid path
+    }
+
+#ifdef _WIN32
+    (void)threads;
+    return 0; // Not supported on Windows
+#else
+    struct stat st;
+    if (lstat(path, &st) != 0)
+    {
+        return errno == ENOENT; // Already gone
+    }
+
+    if (!S_ISDIR(st.st_mode))
+    {
+        return unlink(path) == 0 || errno == ENOENT; // A file or a symbolic link
+    }
+
+    // Refuse to empty the filesystem root
+    char resolved[FLUENT_LIBC_PATH_MAX];
+    if (get_real_path_buff(path, resolved) && resolved[0] == PATH_SEPARATOR && resolved[1] == '\0')
+    {
+        errno = EPERM;
+        return 0; // Refusing to remove "/"
+    }
+
+    __fluent_libc_path_remove_state_t state;
+    state.buffers = NULL;
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&state.error, 0, __ATOMIC_RELAXED);
+
+    __fluent_libc_path_pool_t pool;
+    if (!__fluent_libc_path_pool_init(&pool, threads, __fluent_libc_path_remove_scan, NULL, NULL, &state))
+    {
+        errno = ENOMEM;
+        return 0; // Memory allocation failed
+    }
+
+    // The root goes to the calling thread, which is worker 0
+    state.buffers = (char *)malloc(pool.threads * PATH_WALK_BUFFER_SIZE);
+    __fluent_libc_path_remove_node_t *root = state.buffers ? __fluent_libc_path_remove_node_new(NULL, path, strlen(path)) : NULL;
+    int result = root && __fluent_libc_path_pool_push(&pool, 0, root);
+    if (!result)
+    {
+        free(root);
+        errno = ENOMEM;
+    }
+    else
+    {
+        __fluent_libc_path_pool_run(&pool);
+
+        const int error = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&state.error, __ATOMIC_RELAXED);
+        result = error == 0;
+        if (!result)
+        {
+            errno = error;
+        }
+    }
+
+    __fluent_libc_path_pool_destroy(&pool);
+    free(state.buffers);
+    return result;
+#endif
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_REMOVE_LIBRARY_H
@@ -0,0 +1,531 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_RESOLVE_LIBRARY_H
+#define FLUENT_LIBC_PATH_RESOLVE_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Single-Walk Resolution
+// ----------------------------------------
+// Resolves a path and returns what the caller needs next from the same lookup.
+// Provides:
+//   - get_real_path_stat(path, buffer, cap, st, mask) – Canonical path plus statx() of the final component
+//   - path_open_resolved(path, flags, fd, buffer, cap) – Opens the file and returns its canonical path
+//   - path_from_fd(fd, buffer, cap)                    – Canonical path of an open descriptor
+//   - path_from_fd_batch(fds, n, buffer, cap, paths)   – Same for many descriptors, packed in one buffer
+//   - path_fd_remember(fd, path) / path_fd_forget(fd)  – Names used when the system cannot tell
+//
+// Behavior:
+//   - get_real_path() followed by stat() walks the path twice: realpath(3)
+//     issues one readlink per component, then stat() repeats the lookup.
+//     Here the kernel walks the path once, in open(O_PATH); the metadata comes
+//     from statx() on that descriptor and the canonical name from
+//     /proc/self/fd, so the cost is four syscalls whatever the depth.
+//   - The name and the metadata describe the same inode even if the path is
+//     renamed concurrently.
+//   - path_open_resolved() replaces get_real_path() + validate + open(): the
+//     open itself is the only walk, and the returned descriptor is the file
+//     that was validated, so a rename between the steps cannot swap it.
+//   - Without /proc, the name falls back to get_real_path_buff() (a second
+//     walk); the metadata still comes from the descriptor.
+//   - path_from_fd() never walks a path: it asks the kernel for the name of
+//     the open file (readlink of /proc/self/fd/N on Linux, F_GETPATH on
+//     macOS). If that fails (no /proc, sockets, ...), it returns the name
+//     stored with path_fd_remember(), if any. A file unlinked after it was
+//     opened is reported by Linux as "<path> (deleted)".
+//   - Errors are reported through errno, as set by the failing call
+//     (ERANGE when the canonical path does not fit in the buffer).
+//
+// Memory Management:
+//   - path_fd_remember() copies the name; path_fd_forget() releases it (call it
+//     before closing the descriptor, since descriptor numbers are reused).
+//
+// Dependencies:
+//   - Linux: <fcntl.h>, <sys/syscall.h>, <linux/stat.h> & statx (kernel 4.11+)
+//   - POSIX: <pthread.h> for the remembered names
+//   - Other systems: get_real_path_stat() and path_open_resolved() return 0 with errno = ENOSYS
+//
+// Example:
+// ----------------------------------------
+//   char real[PATH_MAX];
+//   struct statx st;
+//   if (get_real_path_stat("./www/index.html", real, sizeof(real), &st, STATX_TYPE | STATX_SIZE | STATX_MTIME))
+//   {
+//       printf("%s: %llu bytes\n", real, (unsigned long long)st.stx_size);
+//   }
+//
+//   int fd;
+//   if (path_open_resolved(request_path, O_RDONLY, &fd, real, sizeof(real)))
+//   {
+//       if (strncmp(real, "/srv/www/", 9) == 0) { /* serve from fd */ }
+//       close(fd);
+//   }
+//
+//   char name[PATH_MAX];
+//   if (path_from_fd(client_upload_fd, name, sizeof(name))) { log_upload(name); }
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include <errno.h>
+#include <stdio.h>  // For snprintf
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#   include <fcntl.h>   // For open, O_* flags and F_GETPATH
+#   include <pthread.h> // For the remembered names
+#endif
+#ifdef __linux__
+#   include <sys/stat.h>
+#   include <sys/syscall.h> // For SYS_statx
+#   include <linux/stat.h>  // For struct statx and STATX_* masks
+#endif
+
+// ============= MACROS =============
+#ifdef __linux__
+#   ifdef O_PATH
+#       define __FLUENT_LIBC_PATH_O_PATH O_PATH
+#   else
+#       define __FLUENT_LIBC_PATH_O_PATH O_RDONLY // Without _GNU_SOURCE; needs read permission on the target
+#   endif
+#   ifndef AT_EMPTY_PATH
+#       define AT_EMPTY_PATH 0x1000 // Same value on every Linux architecture
+#   endif
+#endif
+
+#ifndef PATH_FD_REGISTRY_SIZE
+#   define PATH_FD_REGISTRY_SIZE 1024 // Descriptors below this number can have a remembered name
+#endif
+
+#ifndef PATH_OPEN_CREATE_MODE
+#   define PATH_OPEN_CREATE_MODE 0666 // Mode given to files created by path_open_resolved (minus the umask)
+#endif
+
+// ============= TYPES =============
+struct statx; // Only complete on Linux
+
+// ============= GLOBALS =============
+#ifndef _WIN32
+#   if defined(FLUENT_LIBC_PATH_INLINE) && !defined(FLUENT_LIBC_PATH_IMPLEMENTATION)
+extern char *__fluent_libc_path_fd_names[PATH_FD_REGISTRY_SIZE];
+extern pthread_mutex_t __fluent_libc_path_fd_lock;
+#   else
+FLUENT_LIBC_PATH_DATA char *__fluent_libc_path_fd_names[PATH_FD_REGISTRY_SIZE]; // Names stored by path_fd_remember
+FLUENT_LIBC_PATH_DATA pthread_mutex_t __fluent_libc_path_fd_lock = PTHREAD_MUTEX_INITIALIZER;
+#   endif
+#endif
+
+// ============= HELPERS =============
+#ifdef __linux__
+/**
+ * @brief Calls statx(2) through syscall(), so older C libraries work too.
+ *
+ * @return 0 on success, -1 with errno set on failure.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_statx(
+    const int dirfd,
+    const char *const name,
+    const int flags,
+    const unsigned int mask,
+    struct statx *const st
+)
+{
+    return (int)syscall(SYS_statx, dirfd, name, flags, mask, st);
+}
+
+/**
+ * @brief Reads the canonical path of an open descriptor from /proc/self/fd.
+ *
+ * @param fd The descriptor.
+ * @param buffer The destination.
+ * @param cap The capacity of buffer, including the terminator.
+ * @param out_len Receives the length of the path (may be NULL).
+ * @return 1 on success, 0 on failure (errno is ERANGE if the path does not fit,
+ *         ENOENT if the descriptor has no path name).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_fd_name(const int fd, char *const buffer, const size_t cap, size_t *const out_len)
+{
+    char link[32];
+    snprintf(link, sizeof(link), "/proc/self/fd/%d", fd);
+
+    const ssize_t len = readlink(link, buffer, cap);
+    if (len < 0)
+    {
+        return 0; // No /proc, or not a descriptor
+    }
+
+    if ((size_t)len >= cap)
+    {
+        errno = ERANGE;
+        return 0; // Does not fit (readlink truncates silently)
+    }
+
+    if (len == 0 || buffer[0] != PATH_SEPARATOR)
+    {
+        errno = ENOENT;
+        return 0; // Sockets, pipes and anonymous inodes have no path
+    }
+
+    buffer[len] = '\0';
+    if (out_len)
+    {
+        *out_len = (size_t)len;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Writes the canonical name of an open descriptor, falling back to the original path.
+ *
+ * @return 1 on success, 0 on failure (errno set).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_resolved_name(
+    const int fd,
+    const char *const path,
+    char *const buffer,
+    const size_t cap,
+    size_t *const out_len
+)
+{
+    if (__fluent_libc_path_fd_name(fd, buffer, cap, out_len))
+    {
+        return 1;
+    }
+
+    if (errno == ERANGE)
+    {
+        return 0; // The name exists but does not fit
+    }
+
+    // No /proc: resolve the name with a second walk
+    char resolved[FLUENT_LIBC_PATH_MAX];
+    if (!get_real_path_buff(path, resolved))
+    {
+        return 0; // The path cannot be resolved
+    }
+
+    const size_t len = strlen(resolved);
+    if (len >= cap)
+    {
+        errno = ERANGE;
+        return 0; // Does not fit
+    }
+
+    memcpy(buffer, resolved, len + 1);
+    if (out_len)
+    {
+        *out_len = len;
+    }
+
+    return 1;
+}
+#endif
+
+// ============= PUBLIC API =============
+/**
+ * @brief Resolves a path and returns the final component's metadata from the same walk.
+ *
+ * @param path The path to resolve. Must not be NULL or empty.
+ * @param buffer Receives the canonical absolute path.
+ * @param cap The capacity of buffer, including the terminator.
+ * @param st Receives the statx() result for the resolved file (may be NULL).
+ * @param mask The STATX_* fields requested (see statx(2)); st->stx_mask reports the ones filled.
+ * @return 1 on success, 0 on failure with errno set.
+ */
+FLUENT_LIBC_PATH_API int get_real_path_stat(
+    const char *const path,
+    char *const buffer,
+    const size_t cap,
+    struct statx *const st,
+    const unsigned int mask
+)
+{
+    if (!path || path[0] == '\0' || !buffer || cap == 0)
+    {
+        errno = EINVAL;
+        return 0; // Invalid arguments
+    }
+
+#ifdef __linux__
+    // One lookup: the kernel resolves every component and symbolic link here
+    const int fd = open(path, __FLUENT_LIBC_PATH_O_PATH | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return 0; // The path cannot be resolved
+    }
+
+    int result = 1;
+    if (st && __fluent_libc_path_statx(fd, "", AT_EMPTY_PATH, mask, st) != 0)
+    {
+        result = 0; // statx failed
+    }
+
+    if (result && !__fluent_libc_path_resolved_name(fd, path, buffer, cap, NULL))
+    {
+        result = 0; // No canonical name
+    }
+
+    const int saved = errno;
+    close(fd);
+    errno = saved;
+    return result;
+#else
+    (void)st;
+    (void)mask;
+    errno = ENOSYS;
+    return 0; // statx is Linux-only
+#endif
+}
+
+/**
+ * @brief Opens a path and returns the descriptor together with its canonical path.
+ *
+ * The kernel resolves the path once, in open(); the canonical name is read
+ * back from the descriptor, so it names exactly the file that was opened.
+ *
+ * @param path The path to open. Must not be NULL or empty.
+ * @param flags open(2) flags (O_CLOEXEC is always added). O_CREAT uses PATH_OPEN_CREATE_MODE.
+ * @param out_fd Receives the descriptor, or -1 on failure. Must not be NULL.
+ * @param buffer Receives the canonical absolute path (may be NULL to only open).
+ * @param cap The capacity of buffer, including the terminator.
+ * @return 1 on success, 0 on failure with errno set (nothing is left open).
+ */
+FLUENT_LIBC_PATH_API int path_open_resolved(
+    const char *const path,
+    const int flags,
+    int *const out_fd,
+    char *const buffer,
+    const size_t cap
+)
+{
+    if (out_fd)
+    {
+        *out_fd = -1;
+    }
+
+    if (!path || path[0] == '\0' || !out_fd || (buffer && cap == 0))
+    {
+        errno = EINVAL;
+        return 0; // Invalid arguments
+    }
+
+#ifdef __linux__
+    const int fd = open(path, flags | O_CLOEXEC, PATH_OPEN_CREATE_MODE);
+    if (fd < 0)
+    {
+        return 0; // The path cannot be opened
+    }
+
+    if (buffer && !__fluent_libc_path_resolved_name(fd, path, buffer, cap, NULL))
+    {
+        const int saved = errno;
+        close(fd);
+        errno = saved;
+        return 0; // No canonical name
+    }
+
+    *out_fd = fd;
+    return 1;
+#else
+    (void)flags;
+    errno = ENOSYS;
+    return 0; // /proc/self/fd is Linux-only
+#endif
+}
+
+/**
+ * @brief Stores the name to report for a descriptor when the system cannot provide one.
+ *
+ * @param fd The descriptor (below PATH_FD_REGISTRY_SIZE).
+ * @param path The name to remember. It is copied.
+ * @return 1 on success, 0 if fd is out of range, path is NULL or memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int path_fd_remember(const int fd, const char *const path)
+{
+#ifndef _WIN32
+    if (fd < 0 || fd >= PATH_FD_REGISTRY_SIZE || !path)
+    {
+        errno = EINVAL;
+        return 0; // Invalid arguments
+    }
+
+    const size_t len = strlen(path);
+    char *copy = (char *)malloc(len + 1);
+    if (!copy)
+    {
+        return 0; // Memory allocation failed
+    }
+    memcpy(copy, path, len + 1);
+
+    pthread_mutex_lock(&__fluent_libc_path_fd_lock);
+    char *previous = __fluent_libc_path_fd_names[fd];
+    __fluent_libc_path_fd_names[fd] = copy;
+    pthread_mutex_unlock(&__fluent_libc_path_fd_lock);
+
+    free(previous);
+    return 1;
+#else
+    (void)fd;
+    (void)path;
+    errno = ENOSYS;
+    return 0; // Not supported on Windows
+#endif
+}
+
+/**
+ * @brief Releases the name remembered for a descriptor.
+ *
+ * @param fd The descriptor.
+ */
+FLUENT_LIBC_PATH_API void path_fd_forget(const int fd)
+{
+#ifndef _WIN32
+    if (fd < 0 || fd >= PATH_FD_REGISTRY_SIZE)
+    {
+        return; // Never remembered
+    }
+
+    pthread_mutex_lock(&__fluent_libc_path_fd_lock);
+    char *previous = __fluent_libc_path_fd_names[fd];
+    __fluent_libc_path_fd_names[fd] = NULL;
+    pthread_mutex_unlock(&__fluent_libc_path_fd_lock);
+
+    free(previous);
+#else
+    (void)fd;
+#endif
+}
+
+/**
+ * @brief Returns the canonical path of an open descriptor without walking any path.
+ *
+ * @param fd The descriptor.
+ * @param buffer Receives the path.
+ * @param cap The capacity of buffer, including the terminator.
+ * @return 1 on success, 0 on failure with errno set (ERANGE if the path does not fit,
+ *         ENOENT if neither the system nor path_fd_remember() knows a name).
+ */
+FLUENT_LIBC_PATH_API int path_from_fd(const int fd, char *const buffer, const size_t cap)
+{
+    if (fd < 0 || !buffer || cap == 0)
+    {
+        errno = EINVAL;
+        return 0; // Invalid arguments
+    }
+
+#ifndef _WIN32
+#   if defined(__linux__)
+    if (__fluent_libc_path_fd_name(fd, buffer, cap, NULL))
+    {
+        return 1; // One readlink on /proc/self/fd/N
+    }
+#   elif defined(F_GETPATH)
+    char name[FLUENT_LIBC_PATH_MAX > 1024 ? FLUENT_LIBC_PATH_MAX : 1024]; // F_GETPATH needs MAXPATHLEN bytes
+    if (fcntl(fd, F_GETPATH, name) != -1)
+    {
+        const size_t len = strlen(name);
+        if (len >= cap)
+        {
+            errno = ERANGE;
+            return 0; // Does not fit
+        }
+
+        memcpy(buffer, name, len + 1);
+        return 1;
+    }
+#   endif
+
+    if (errno == ERANGE)
+    {
+        return 0; // The name exists but does not fit
+    }
+
+    // Fall back to the remembered name
+    int result = 0;
+    if (fd < PATH_FD_REGISTRY_SIZE)
+    {
+        pthread_mutex_lock(&__fluent_libc_path_fd_lock);
+        const char *remembered = __fluent_libc_path_fd_names[fd];
+        if (remembered)
+        {
+            const size_t len = strlen(remembered);
+            if (len < cap)
+            {
+                memcpy(buffer, remembered, len + 1);
+                result = 1;
+            }
+            else
+            {
+                errno = ERANGE; // Does not fit
+            }
+        }
+        pthread_mutex_unlock(&__fluent_libc_path_fd_lock);
+    }
+
+    if (!result && errno != ERANGE)
+    {
+        errno = ENOENT; // Nothing known about this descriptor
+    }
+
+    return result;
+#else
+    errno = ENOSYS;
+    return 0; // Not supported on Windows
+#endif
+}
+
+/**
+ * @brief Returns the canonical paths of many descriptors, packed into one buffer.
+ *
+ * @param fds The descriptors.
+ * @param n The number of descriptors.
+ * @param buffer Receives the NUL-terminated paths, one after another.
+ * @param cap The capacity of buffer.
+ * @param paths Receives, per descriptor, a pointer into buffer or NULL if it has no name
+ *              (or the buffer is full).
+ * @return The number of descriptors whose path was written.
+ */
+FLUENT_LIBC_PATH_API size_t path_from_fd_batch(
+    const int *const fds,
+    const size_t n,
+    char *const buffer,
+    const size_t cap,
+    const char **const paths
+)
+{
+    size_t used = 0;
+    size_t resolved = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        paths[i] = NULL;
+        if (used < cap && path_from_fd(fds[i], buffer + used, cap - used))
+        {
+            paths[i] = buffer + used;
+            used += strlen(buffer + used) + 1;
+            resolved++;
+        }
+    }
+
+    return resolved;
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_RESOLVE_LIBRARY_H
@@ -0,0 +1,339 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_SANITIZE_LIBRARY_H
+#define FLUENT_LIBC_PATH_SANITIZE_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Path Sanitization
+// ----------------------------------------
+// Validates and lexically normalizes untrusted paths in a single scan.
+// Provides:
+//   - path_sanitize_into(path, out, cap, flags, &len)       – Sanitizes a NUL-terminated path
+//   - path_sanitize_into_slice(path, out, cap, flags, &len) – Same, on a path_slice_t
+//                                                              (catches embedded NUL bytes)
+//
+// Behavior:
+//   - One pass over the input does all of the following:
+//       - validates UTF-8 (overlong forms, surrogates and code points past
+//         U+10FFFF are invalid);
+//       - rejects forbidden bytes: NUL, the C0 control characters and DEL;
+//       - collapses repeated separators and drops "." components and
+//         trailing separators;
+//       - resolves ".." against the components already written.
+//   - Runs of 8 plain ASCII bytes (no controls, no separators) are checked with
+//     a handful of word-wide operations and copied as a block.
+//   - ".." that would climb above the start of a relative path is rejected
+//     unless PATH_SANITIZE_ALLOW_PARENT is given; above "/" it is dropped.
+//   - With PATH_SANITIZE_REPLACE, invalid sequences and forbidden bytes are
+//     replaced by U+FFFD instead of failing the call.
+//   - An input that normalizes to nothing yields "." (or "/" if absolute).
+//   - On failure, errno is set to EILSEQ (invalid UTF-8 or forbidden byte),
+//     EINVAL (".." escapes the path or invalid arguments) or ENAMETOOLONG
+//     (the output does not fit).
+//   - This is purely lexical: the filesystem is never accessed.
+//
+// Example:
+// ----------------------------------------
+//   char clean[PATH_MAX];
+//   size_t len;
+//   if (!path_sanitize_into("uploads//2024/./a/../report.pdf", clean, sizeof(clean), 0, &len))
+//   {
+//       // errno tells why
+//   }
+//   // clean == "uploads/2024/report.pdf"
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_compare.h"
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+// ============= TYPES =============
+/**
+ * @brief Flags accepted by path_sanitize_into().
+ */
+typedef enum
+{
+    PATH_SANITIZE_REPLACE = 1 << 0,      // Replace bad sequences and bytes with U+FFFD instead of failing
+    PATH_SANITIZE_ALLOW_PARENT = 1 << 1, // Keep ".." components that climb above a relative path
+    PATH_SANITIZE_BACKSLASH = 1 << 2     // Treat '\' as a separator (paths from Windows clients)
+} path_sanitize_flags_t;
+
+// ============= HELPERS =============
+/**
+ * @brief Checks whether a word has a byte below n (n <= 128).
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_sanitize_has_less(const uint64_t word, const uint64_t n)
+{
+    return (word - 0x0101010101010101ULL * n) & ~word & 0x8080808080808080ULL;
+}
+
+/**
+ * @brief Checks whether a word has a byte equal to c.
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_sanitize_has_byte(const uint64_t word, const uint64_t c)
+{
+    return __fluent_libc_path_sanitize_has_less(word ^ (0x0101010101010101ULL * c), 1);
+}
+
+/**
+ * @brief Checks whether 8 bytes are plain ASCII component bytes (no controls, DEL or separators).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_sanitize_plain8(const uint64_t word, const int flags)
+{
+    if (word & 0x8080808080808080ULL)
+    {
+        return 0; // Non-ASCII
+    }
+
+    if (__fluent_libc_path_sanitize_has_less(word, 0x20) || __fluent_libc_path_sanitize_has_byte(word, 0x7F))
+    {
+        return 0; // Control character or DEL
+    }
+
+    if (__fluent_libc_path_sanitize_has_byte(word, '/') || __fluent_libc_path_sanitize_has_byte(word, PATH_SEPARATOR))
+    {
+        return 0; // Separator
+    }
+
+    return !(flags & PATH_SANITIZE_BACKSLASH) || !__fluent_libc_path_sanitize_has_byte(word, '\\');
+}
+
+/**
+ * @brief Checks whether a byte separates components under the given flags.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_sanitize_is_sep(const unsigned char c, const int flags)
+{
+    return c == '/' || c == PATH_SEPARATOR || (c == '\\' && (flags & PATH_SANITIZE_BACKSLASH));
+}
+
+// ============= PUBLIC API =============
+/**
+ * @brief Validates and lexically normalizes a path slice into a caller buffer.
+ *
+ * @param path The untrusted path. May contain any bytes.
+ * @param out The destination buffer.
+ * @param cap The capacity of out, including the NUL terminator.
+ * @param flags A combination of path_sanitize_flags_t values.
+ * @param out_len Receives the length of the sanitized path (may be NULL).
+ * @return 1 on success, 0 on failure (see errno).
+ */
+#ifdef __FLUENT_LIBC_PATH_HOT_EXTERN
+int path_sanitize_into_slice(path_slice_t path, char *out, size_t cap, int flags, size_t *out_len);
+#else
+FLUENT_LIBC_PATH_HOT FLUENT_LIBC_PATH_API int path_sanitize_into_slice(
+    const path_slice_t path,
+    char *const out,
+    const size_t cap,
+    const int flags,
+    size_t *const out_len
+)
+{
+    // Validate the input
+    if ((!path.ptr && path.len) || !out || cap < 2)
+    {
+        errno = EINVAL;
+        return 0; // Invalid arguments
+    }
+
+    const unsigned char *s = (const unsigned char *)path.ptr;
+    const size_t len = path.len;
+    const int absolute = len > 0 && __fluent_libc_path_sanitize_is_sep(s[0], flags);
+    const size_t limit = cap - 1; // Room for the terminator
+    size_t o = 0;                 // Output length
+    size_t i = 0;                 // Input position
+
+    if (absolute)
+    {
+        out[o++] = PATH_SEPARATOR;
+    }
+
+    const size_t base = o;  // Output position after the root
+    size_t parents = base;  // End of the leading ".." components kept in the output
+
+    while (i < len)
+    {
+        // Collapse separators
+        while (i < len && __fluent_libc_path_sanitize_is_sep(s[i], flags))
+        {
+            i++;
+        }
+        if (i == len)
+        {
+            break;
+        }
+
+        // Start the component (after a separator unless it is the first)
+        const size_t component_start = o;
+        if (o > base)
+        {
+            if (o >= limit)
+            {
+                errno = ENAMETOOLONG;
+                return 0; // Output too long
+            }
+            out[o++] = PATH_SEPARATOR;
+        }
+        const size_t body = o;
+
+        // Copy and validate the component
+        while (i < len && !__fluent_libc_path_sanitize_is_sep(s[i], flags))
+        {
+            // Fast path: 8 plain ASCII bytes at once
+            uint64_t word;
+            if (i + 8 <= len)
+            {
+                memcpy(&word, s + i, sizeof(word));
+                if (__fluent_libc_path_sanitize_plain8(word, flags))
+                {
+                    if (o + 8 > limit)
+                    {
+                        errno = ENAMETOOLONG;
+                        return 0; // Output too long
+                    }
+                    memcpy(out + o, &word, sizeof(word));
+                    o += 8;
+                    i += 8;
+                    continue;
+                }
+            }
+
+            // Slow path: one character
+            const unsigned char c = s[i];
+            size_t next = i;
+            int bad;
+            if (c < 0x80)
+            {
+                next++;
+                bad = c < 0x20 || c == 0x7F; // NUL, control characters and DEL
+            }
+            else
+            {
+                bad = __fluent_libc_path_compare_decode(s, len, &next) >= __FLUENT_LIBC_PATH_COMPARE_INVALID;
+            }
+
+            const char *bytes = (const char *)s + i;
+            size_t count = next - i;
+            if (bad)
+            {
+                if (!(flags & PATH_SANITIZE_REPLACE))
+                {
+                    errno = EILSEQ;
+                    return 0; // Invalid UTF-8 or forbidden byte
+                }
+
+                bytes = "\xEF\xBF\xBD"; // U+FFFD REPLACEMENT CHARACTER
+                count = 3;
+            }
+
+            if (o + count > limit)
+            {
+                errno = ENAMETOOLONG;
+                return 0; // Output too long
+            }
+            memcpy(out + o, bytes, count);
+            o += count;
+            i = next;
+        }
+
+        // Resolve "." and ".." against what was written so far
+        const size_t component_len = o - body;
+        if (component_len == 1 && out[body] == '.')
+        {
+            o = component_start; // Current directory
+        }
+        else if (component_len == 2 && out[body] == '.' && out[body + 1] == '.')
+        {
+            o = component_start;
+            if (o > parents)
+            {
+                // Drop the previous component
+                while (o > parents && out[o - 1] != PATH_SEPARATOR)
+                {
+                    o--;
+                }
+                if (o > base)
+                {
+                    o--; // And its separator
+                }
+            }
+            else if (!absolute)
+            {
+                if (!(flags & PATH_SANITIZE_ALLOW_PARENT))
+                {
+                    errno = EINVAL;
+                    return 0; // Climbs above the start of the path
+                }
+
+                // Keep the ".." (it was already written at body)
+                o = body + 2;
+                parents = o;
+            }
+        }
+    }
+
+    // An empty result is the current directory
+    if (o == 0)
+    {
+        out[o++] = '.';
+    }
+
+    out[o] = '\0';
+    if (out_len)
+    {
+        *out_len = o;
+    }
+
+    return 1;
+}
+#endif
+
+/**
+ * @brief Validates and lexically normalizes a path into a caller buffer.
+ *
+ * @param path The untrusted, NUL-terminated path. Must not be NULL.
+ * @param out The destination buffer.
+ * @param cap The capacity of out, including the NUL terminator.
+ * @param flags A combination of path_sanitize_flags_t values.
+ * @param out_len Receives the length of the sanitized path (may be NULL).
+ * @return 1 on success, 0 on failure (see errno).
+ */
+FLUENT_LIBC_PATH_API int path_sanitize_into(
+    const char *const path,
+    char *const out,
+    const size_t cap,
+    const int flags,
+    size_t *const out_len
+)
+{
+    if (!path)
+    {
+        errno = EINVAL;
+        return 0; // Invalid path
+    }
+
+    return path_sanitize_into_slice(path_slice(path), out, cap, flags, out_len);
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_SANITIZE_LIBRARY_H
@@ -0,0 +1,1192 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_SNAPSHOT_LIBRARY_H
+#define FLUENT_LIBC_PATH_SNAPSHOT_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Tree Snapshots
+// ----------------------------------------
+// Records a directory tree into a compact binary file and diffs two recordings.
+// Provides:
+//   - path_snapshot_write(root, file)               – Walks root and writes its snapshot to file
+//   - path_snapshot_open(file, snapshot)            – Maps a snapshot file (read-only)
+//   - path_snapshot_close(snapshot)                 – Unmaps it
+//   - path_snapshot_name(snapshot, entry)           – The name of an entry
+//   - path_snapshot_diff(old, new, callback, user)  – Reports added, removed and modified entries
+//
+// Behavior:
+//   - A snapshot holds one fixed-size record per entry (inode, size, mtime in
+//     nanoseconds, mode) in pre-order, with the entries of every directory
+//     sorted by name. Names are stored once each in a name table (a component
+//     such as "src" or "index.js" is shared by every entry that bears it).
+//     Every record knows the index past its last descendant, so a subtree is a
+//     contiguous range that can be skipped in O(1).
+//   - Every directory also records a digest of all the records below it.
+//     A directory's own mtime only changes when entries are added, removed or
+//     renamed, not when a file inside is rewritten; the digest covers both, so
+//     the diff prunes a whole subtree as soon as the two digests agree.
+//   - path_snapshot_diff() merge-joins the sorted entries of matching directories:
+//     linear in the size of the changed subtrees, with no system call.
+//     Directories are reported as modified only when their inode or mode changed;
+//     their mtime and size changes show up as the entries added or removed inside.
+//     An entry whose type changed is reported as removed, then added. When a
+//     directory is added or removed, every entry below it is reported too.
+//   - The walk opens directories with openat() relative to their parent and
+//     measures entries with fstatat(AT_SYMLINK_NOFOLLOW); symbolic links are
+//     recorded, never followed. A directory that cannot be read makes the whole
+//     write fail, so that a sync never mistakes it for a deletion.
+//   - Files are written to "<file>.tmp", synced and renamed over file.
+//   - The format uses the host's byte order; a snapshot from a host with the
+//     other byte order is rejected by path_snapshot_open().
+//
+// Memory Management:
+//   - path_snapshot_open() maps the file; entries and names point into the
+//     mapping until path_snapshot_close(). Change paths passed to the diff
+//     callback are only valid during the call.
+//
+// Dependencies:
+//   - POSIX: openat/fstatat, mmap, path_walk.h (directory reader), path_hash.h
+//   - Windows: not supported, every function fails with ENOSYS
+//
+// Example:
+// ----------------------------------------
+//   int print_change(const path_snapshot_change_t *change, void *user)
+//   {
+//       (void)user;
+//       const char kind = change->kind == PATH_SNAPSHOT_ADDED ? '+' : change->kind == PATH_SNAPSHOT_REMOVED ? '-' : '~';
+//       printf("%c %s\n", kind, change->path);
+//       return 0; // Keep going
+//   }
+//
+//   path_snapshot_write("/srv/data", "state.new");
+//   path_snapshot_t old_snap, new_snap;
+//   if (path_snapshot_open("state", &old_snap) && path_snapshot_open("state.new", &new_snap))
+//   {
+//       path_snapshot_diff(&old_snap, &new_snap, print_change, NULL);
+//   }
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_hash.h" // For __fluent_libc_path_hash_*
+#include "path_walk.h" // For path_dir_reader_t
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h> // For rename
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#   include <fcntl.h>    // For openat and O_* flags
+#   include <sys/mman.h> // For mmap
+#   include <sys/stat.h> // For fstatat
+#endif
+
+// ============= MACROS =============
+#define PATH_SNAPSHOT_NO_PARENT UINT32_MAX // Parent index of the root entry
+
+#define __FLUENT_LIBC_PATH_SNAPSHOT_MAGIC 0x3150414E53504C46ULL // "FLPSNAP1" in little endian
+#define __FLUENT_LIBC_PATH_SNAPSHOT_VERSION 1
+
+// ============= TYPES =============
+/**
+ * @brief One recorded entry, as stored in the file.
+ */
+typedef struct
+{
+    uint64_t ino;      // Inode number
+    uint64_t size;     // st_size
+    int64_t mtime_ns;  // Modification time in nanoseconds since the epoch
+    uint64_t digest;   // Directories: digest of every record below; 0 otherwise
+    uint32_t parent;   // Index of the containing directory (PATH_SNAPSHOT_NO_PARENT for the root)
+    uint32_t end;      // Index past the last entry below (index + 1 for non-directories)
+    uint32_t name;     // Offset of the NUL-terminated name in the name table ("" for the root)
+    uint32_t mode;     // st_mode
+} path_snapshot_entry_t;
+
+/**
+ * @brief A mapped snapshot.
+ */
+typedef struct
+{
+    const path_snapshot_entry_t *entries; // Pre-order records; entries[0] is the root
+    size_t count;                         // Number of records
+    const char *names;                    // Name table
+    size_t names_size;                    // Size of the name table in bytes
+    void *map;                            // The mapping
+    size_t map_size;                      // Size of the mapping
+} path_snapshot_t;
+
+/**
+ * @brief Kinds of changes reported by path_snapshot_diff().
+ */
+typedef enum
+{
+    PATH_SNAPSHOT_ADDED = 1,    // Only in the new snapshot
+    PATH_SNAPSHOT_REMOVED = 2,  // Only in the old snapshot
+    PATH_SNAPSHOT_MODIFIED = 3  // In both, with a different record
+} path_snapshot_change_kind_t;
+
+/**
+ * @brief A change reported by path_snapshot_diff().
+ */
+typedef struct
+{
+    path_snapshot_change_kind_t kind;       // What happened
+    const char *path;                       // Path relative to the root (NUL-terminated)
+    size_t path_len;                        // Length of path in bytes
+    const path_snapshot_entry_t *old_entry; // Record in the old snapshot (NULL when added)
+    const path_snapshot_entry_t *new_entry; // Record in the new snapshot (NULL when removed)
+} path_snapshot_change_t;
+
+/**
+ * @brief Callback invoked for every change. Returns 0 to continue, non-zero to stop the diff.
+ */
+typedef int (*path_snapshot_diff_callback_t)(const path_snapshot_change_t *change, void *user_data);
+
+/**
+ * @brief The header at the start of a snapshot file.
+ */
+typedef struct
+{
+    uint64_t magic;      // __FLUENT_LIBC_PATH_SNAPSHOT_MAGIC (also detects the byte order)
+    uint32_t version;    // __FLUENT_LIBC_PATH_SNAPSHOT_VERSION
+    uint32_t entry_size; // sizeof(path_snapshot_entry_t)
+    uint64_t count;      // Number of records
+    uint64_t names_size; // Size of the name table in bytes
+} __fluent_libc_path_snapshot_header_t;
+
+#ifndef _WIN32
+/**
+ * @brief A directory entry waiting to be recorded.
+ */
+typedef struct
+{
+    const char *name; // Name (points into the frame's scratch once the listing is complete)
+    size_t name_off;  // Offset of name in the scratch while listing
+    size_t name_len;  // Length of name
+    struct stat st;   // Its metadata
+} __fluent_libc_path_snapshot_child_t;
+
+/**
+ * @brief A directory being recorded.
+ */
+typedef struct
+{
+    int fd;                                        // Open directory fd
+    uint32_t index;                                // Its record
+    __fluent_libc_path_snapshot_child_t *children; // Sorted entries
+    size_t count;                                  // Number of entries
+    size_t next;                                   // Next entry to record
+    char *scratch;                                 // Storage for the entry names
+    uint64_t digest;                               // Digest of the records written so far
+} __fluent_libc_path_snapshot_frame_t;
+
+/**
+ * @brief State of path_snapshot_write().
+ */
+typedef struct
+{
+    path_snapshot_entry_t *entries; // Records written so far
+    size_t count;                   // Number of records
+    size_t cap;                     // Capacity of entries
+    char *names;                    // Name table
+    size_t names_size;              // Bytes used in names
+    size_t names_cap;               // Capacity of names
+    uint32_t *intern;               // Hash set of name offsets + 1 (0 = free slot)
+    size_t intern_mask;             // Number of intern slots minus one
+    size_t intern_count;            // Number of interned names
+    char *buffer;                   // Scratch memory for the directory reader
+} __fluent_libc_path_snapshot_writer_t;
+
+/**
+ * @brief A pair of sibling ranges being merged by path_snapshot_diff().
+ */
+typedef struct
+{
+    size_t old_pos;                           // Next old entry
+    size_t old_end;                           // End of the old range
+    size_t new_pos;                           // Next new entry
+    size_t new_end;                           // End of the new range
+    size_t path_len;                          // Length of the directory's path in the path buffer
+    const path_snapshot_entry_t *announce;    // New entry to report as added before the range, or NULL
+} __fluent_libc_path_snapshot_range_t;
+#endif
+
+// ============= HELPERS =============
+#ifndef _WIN32
+/**
+ * @brief Returns the modification time of a stat result in nanoseconds.
+ */
+FLUENT_LIBC_PATH_API int64_t __fluent_libc_path_snapshot_mtime_ns(const struct stat *const st)
+{
+#   ifdef __APPLE__
+    return (int64_t)st->st_mtimespec.tv_sec * 1000000000 + (int64_t)st->st_mtimespec.tv_nsec;
+#   else
+    return (int64_t)st->st_mtim.tv_sec * 1000000000 + (int64_t)st->st_mtim.tv_nsec;
+#   endif
+}
+
+/**
+ * @brief Hashes a record (its name, metadata and, for directories, its digest).
+ */
+FLUENT_LIBC_PATH_API uint64_t __fluent_libc_path_snapshot_hash_entry(
+    const path_snapshot_entry_t *const entry,
+    const char *const name,
+    const size_t name_len
+)
+{
+    uint64_t h = __fluent_libc_path_hash_bytes(name, name_len);
+    h = __fluent_libc_path_hash_mum(h ^ __FLUENT_LIBC_PATH_HASH_P0, entry->ino ^ __FLUENT_LIBC_PATH_HASH_P1);
+    h = __fluent_libc_path_hash_mum(h ^ entry->size, (uint64_t)entry->mtime_ns ^ __FLUENT_LIBC_PATH_HASH_P2);
+    return __fluent_libc_path_hash_mum(h ^ entry->mode, entry->digest ^ __FLUENT_LIBC_PATH_HASH_P3);
+}
+
+/**
+ * @brief Compares two directory entries by name.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_snapshot_child_cmp(const void *const a, const void *const b)
+{
+    return strcmp(
+        ((const __fluent_libc_path_snapshot_child_t *)a)->name,
+        ((const __fluent_libc_path_snapshot_child_t *)b)->name
+    );
+}
+
+/**
+ * @brief Stores a name in the name table, once.
+ *
+ * @return 1 on success with *offset set, 0 on failure (errno set).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_snapshot_intern(
+    __fluent_libc_path_snapshot_writer_t *const writer,
+    const char *const name,
+    const size_t len,
+    uint32_t *const offset
+)
+{
+    // Keep the load at one half at most
+    if ((writer->intern_count + 1) * 2 > writer->intern_mask + 1)
+    {
+        const size_t slots = (writer->intern_mask + 1) * 2;
+        uint32_t *table = (uint32_t *)calloc(slots, sizeof(uint32_t));
+        if (!table)
+        {
+            errno = ENOMEM;
+            return 0; // Memory allocation failed
+        }
+
+        for (size_t i = 0; i <= writer->intern_mask; i++)
+        {
+            if (!writer->intern[i])
+            {
+                continue;
+            }
+
+            const char *stored = writer->names + writer->intern[i] - 1;
+            size_t j = (size_t)__fluent_libc_path_hash_bytes(stored, strlen(stored)) & (slots - 1);
+            while (table[j])
+            {
+                j = (j + 1) & (slots - 1); // Linear probing
+            }
+            table[j] = writer->intern[i];
+        }
+
+        free(writer->intern);
+        writer->intern = table;
+        writer->intern_mask = slots - 1;
+    }
+
+    size_t i = (size_t)__fluent_libc_path_hash_bytes(name, len) & writer->intern_mask;
+    while (writer->intern[i])
+    {
+        const char *stored = writer->names + writer->intern[i] - 1;
+        if (strncmp(stored, name, len) == 0 && stored[len] == '\0')
+        {
+            *offset = writer->intern[i] - 1;
+            return 1; // Already stored
+        }
+        i = (i + 1) & writer->intern_mask;
+    }
+
+    if (writer->names_size + len + 1 >= UINT32_MAX)
+    {
+        errno = EOVERFLOW;
+        return 0; // The name table is full
+    }
+
+    if (writer->names_size + len + 1 > writer->names_cap)
+    {
+        size_t cap = writer->names_cap ? writer->names_cap * 2 : 4096;
+        while (cap < writer->names_size + len + 1)
+        {
+            cap *= 2;
+        }
+
+        char *names = (char *)realloc(writer->names, cap);
+        if (!names)
+        {
+            errno = ENOMEM;
+            return 0; // Memory allocation failed
+        }
+
+        writer->names = names;
+        writer->names_cap = cap;
+    }
+
+    *offset = (uint32_t)writer->names_size;
+    memcpy(writer->names + writer->names_size, name, len);
+    writer->names[writer->names_size + len] = '\0';
+    writer->names_size += len + 1;
+    writer->intern[i] = *offset + 1;
+    writer->intern_count++;
+    return 1;
+}
+
+/**
+ * @brief Appends a record.
+ *
+ * @return 1 on success with *index set, 0 on failure (errno set).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_snapshot_append(
+    __fluent_libc_path_snapshot_writer_t *const writer,
+    const struct stat *const st,
+    const uint32_t parent,
+    const char *const name,
+    const size_t name_len,
+    uint32_t *const index
+)
+{
+    if (writer->count >= UINT32_MAX - 1)
+    {
+        errno = EOVERFLOW;
+        return 0; // Too many entries
+    }
+
+    if (writer->count == writer->cap)
+    {
+        const size_t cap = writer->cap ? writer->cap * 2 : 1024;
+        path_snapshot_entry_t *entries =
+            (path_snapshot_entry_t *)realloc(writer->entries, cap * sizeof(path_snapshot_entry_t));
+        if (!entries)
+        {
+            errno = ENOMEM;
+            return 0; // Memory allocation failed
+        }
+
+        writer->entries = entries;
+        writer->cap = cap;
+    }
+
+    path_snapshot_entry_t *entry = &writer->entries[writer->count];
+    if (!__fluent_libc_path_snapshot_intern(writer, name, name_len, &entry->name))
+    {
+        return 0; // Memory allocation failed
+    }
+
+    entry->ino = (uint64_t)st->st_ino;
+    entry->size = (uint64_t)st->st_size;
+    entry->mtime_ns = __fluent_libc_path_snapshot_mtime_ns(st);
+    entry->digest = 0;
+    entry->parent = parent;
+    entry->end = (uint32_t)writer->count + 1;
+    entry->mode = (uint32_t)st->st_mode;
+    *index = (uint32_t)writer->count++;
+    return 1;
+}
+
+/**
+ * @brief Reads, measures and sorts the entries of a directory.
+ *
+ * The frame takes ownership of fd.
+ *
+ * @return 1 on success, 0 on failure (errno set).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_snapshot_list(
+    __fluent_libc_path_snapshot_writer_t *const writer,
+    __fluent_libc_path_snapshot_frame_t *const frame,
+    const int fd,
+    const uint32_t index
+)
+{
+    frame->fd = fd;
+    frame->index = index;
+    frame->children = NULL;
+    frame->count = 0;
+    frame->next = 0;
+    frame->scratch = NULL;
+    frame->digest = __FLUENT_LIBC_PATH_HASH_P3;
+
+    // The reader owns the fd it is given; keep frame->fd open for the subdirectories
+#ifdef __linux__
+    const int read_fd = fd;
+#else
+    const int read_fd = dup(fd);
+#endif
+    path_dir_reader_t reader;
+    if (read_fd < 0 || !path_dir_reader_open(&reader, read_fd, writer->buffer, PATH_WALK_BUFFER_SIZE))
+    {
+        return 0; // Cannot be read
+    }
+
+    size_t cap = 0;
+    size_t scratch_size = 0;
+    size_t scratch_cap = 0;
+    const char *name;
+    size_t name_len;
+    path_walk_type_t type;
+    int status;
+    while ((status = path_dir_reader_next(&reader, &name, &name_len, &type)) > 0)
+    {
+        struct stat st;
+        if (fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+        {
+            if (errno == ENOENT)
+            {
+                continue; // Removed meanwhile
+            }
+            status = -1;
+            break;
+        }
+
+        if (frame->count == cap || scratch_size + name_len + 1 > scratch_cap)
+        {
+            if (frame->count == cap)
+            {
+                cap = cap ? cap * 2 : 16;
+                __fluent_libc_path_snapshot_child_t *children = (__fluent_libc_path_snapshot_child_t *)realloc(
+                    frame->children, cap * sizeof(__fluent_libc_path_snapshot_child_t));
+                if (!children)
+                {
+                    errno = ENOMEM;
+                    status = -1;
+                    break; // Memory allocation failed
+                }
+                frame->children = children;
+            }
+
+            if (scratch_size + name_len + 1 > scratch_cap)
+            {
+                scratch_cap = scratch_cap ? scratch_cap * 2 : 256;
+                while (scratch_cap < scratch_size + name_len + 1)
+                {
+                    scratch_cap *= 2;
+                }
+
+                char *scratch = (char *)realloc(frame->scratch, scratch_cap);
+                if (!scratch)
+                {
+                    errno = ENOMEM;
+                    status = -1;
+                    break; // Memory allocation failed
+                }
+                frame->scratch = scratch;
+            }
+        }
+
+        __fluent_libc_path_snapshot_child_t *child = &frame->children[frame->count++];
+        child->name_off = scratch_size;
+        child->name_len = name_len;
+        child->st = st;
+        memcpy(frame->scratch + scratch_size, name, name_len + 1);
+        scratch_size += name_len + 1;
+    }
+
+#ifndef __linux__
+    path_dir_reader_close(&reader);
+#endif
+
+    if (status < 0)
+    {
+        return 0; // Failed to read or measure an entry
+    }
+
+    // The scratch no longer moves: resolve the names and sort by them
+    for (size_t i = 0; i < frame->count; i++)
+    {
+        frame->children[i].name = frame->scratch + frame->children[i].name_off;
+    }
+    if (frame->count > 1)
+    {
+        qsort(frame->children, frame->count, sizeof(__fluent_libc_path_snapshot_child_t),
+              __fluent_libc_path_snapshot_child_cmp);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Releases a frame and closes its directory.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_snapshot_frame_free(__fluent_libc_path_snapshot_frame_t *const frame)
+{
+    close(frame->fd);
+    free(frame->children);
+    free(frame->scratch);
+}
+
+/**
+ * @brief Records the tree below an open root directory, in pre-order.
+ *
+ * Takes ownership of root_fd.
+ *
+ * @return 1 on success, 0 on failure (errno set).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_snapshot_walk(
+    __fluent_libc_path_snapshot_writer_t *const writer,
+    const int root_fd,
+    const struct stat *const root_st
+)
+{
+    uint32_t root_index;
+    size_t cap = 16;
+    size_t depth = 0;
+    __fluent_libc_path_snapshot_frame_t *frames =
+        (__fluent_libc_path_snapshot_frame_t *)malloc(cap * sizeof(__fluent_libc_path_snapshot_frame_t));
+    if (!frames || !__fluent_libc_path_snapshot_append(writer, root_st, PATH_SNAPSHOT_NO_PARENT, "", 0, &root_index))
+    {
+        free(frames);
+        close(root_fd);
+        errno = ENOMEM;
+        return 0; // Memory allocation failed
+    }
+
+    int ok = __fluent_libc_path_snapshot_list(writer, &frames[0], root_fd, root_index);
+    depth = 1;
+    while (ok && depth > 0)
+    {
+        __fluent_libc_path_snapshot_frame_t *frame = &frames[depth - 1];
+        if (frame->next == frame->count)
+        {
+            // Directory done: close its range and fold its record into the parent's digest
+            path_snapshot_entry_t *entry = &writer->entries[frame->index];
+            entry->end = (uint32_t)writer->count;
+            entry->digest = frame->digest;
+            __fluent_libc_path_snapshot_frame_free(frame);
+            depth--;
+            if (depth > 0)
+            {
+                const char *name = writer->names + entry->name;
+                frames[depth - 1].digest = __fluent_libc_path_hash_chain(
+                    frames[depth - 1].digest,
+                    __fluent_libc_path_snapshot_hash_entry(entry, name, strlen(name))
+                );
+            }
+            continue;
+        }
+
+        const __fluent_libc_path_snapshot_child_t *child = &frame->children[frame->next++];
+        uint32_t index;
+        if (!__fluent_libc_path_snapshot_append(writer, &child->st, frame->index, child->name, child->name_len, &index))
+        {
+            ok = 0;
+            break; // Memory allocation failed
+        }
+
+        int fd = -1;
+        if (S_ISDIR(child->st.st_mode))
+        {
+            fd = openat(frame->fd, child->name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+            if (fd < 0 && errno != ENOENT && errno != ENOTDIR)
+            {
+                ok = 0;
+                break; // Cannot be opened
+            }
+        }
+
+        if (fd < 0)
+        {
+            // A file, or a directory replaced meanwhile: recorded without entries
+            frame->digest = __fluent_libc_path_hash_chain(
+                frame->digest,
+                __fluent_libc_path_snapshot_hash_entry(&writer->entries[index], child->name, child->name_len)
+            );
+            continue;
+        }
+
+        if (depth == cap)
+        {
+            cap *= 2;
+            __fluent_libc_path_snapshot_frame_t *grown = (__fluent_libc_path_snapshot_frame_t *)realloc(
+                frames, cap * sizeof(__fluent_libc_path_snapshot_frame_t));
+            if (!grown)
+            {
+                close(fd);
+                errno = ENOMEM;
+                ok = 0;
+                break; // Memory allocation failed
+            }
+            frames = grown;
+        }
+
+        ok = __fluent_libc_path_snapshot_list(writer, &frames[depth], fd, index);
+        depth++;
+    }
+
+    // On failure, close whatever is still open
+    const int saved = errno;
+    while (depth > 0)
+    {
+        __fluent_libc_path_snapshot_frame_free(&frames[--depth]);
+    }
+    free(frames);
+    errno = saved;
+    return ok;
+}
+
+/**
+ * @brief Writes a whole buffer to an fd.
+ *
+ * @return 1 on success, 0 on failure (errno set).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_snapshot_write_all(const int fd, const void *const data, const size_t size)
+{
+    const char *p = (const char *)data;
+    size_t left = size;
+    while (left > 0)
+    {
+        const ssize_t written = write(fd, p, left);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue; // Interrupted: try again
+            }
+            return 0; // Write failed
+        }
+
+        p += written;
+        left -= (size_t)written;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Writes the header, the records and the name table to a temporary file and renames it over file.
+ *
+ * @return 1 on success, 0 on failure (errno set).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_snapshot_store(
+    const __fluent_libc_path_snapshot_writer_t *const writer,
+    const char *const file
+)
+{
+    const size_t len = strlen(file);
+    char *tmp = (char *)malloc(len + sizeof(".tmp"));
+    if (!tmp)
+    {
+        errno = ENOMEM;
+        return 0; // Memory allocation failed
+    }
+    memcpy(tmp, file, len);
+    memcpy(tmp + len, ".tmp", sizeof(".tmp"));
+
+    const int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        free(tmp);
+        return 0; // Cannot create the file
+    }
+
+    __fluent_libc_path_snapshot_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = __FLUENT_LIBC_PATH_SNAPSHOT_MAGIC;
+    header.version = __FLUENT_LIBC_PATH_SNAPSHOT_VERSION;
+    header.entry_size = (uint32_t)sizeof(path_snapshot_entry_t);
+    header.count = writer->count;
+    header.names_size = writer->names_size;
+
+    int ok = __fluent_libc_path_snapshot_write_all(fd, &header, sizeof(header)) &&
+             __fluent_libc_path_snapshot_write_all(fd, writer->entries, writer->count * sizeof(path_snapshot_entry_t)) &&
+             __fluent_libc_path_snapshot_write_all(fd, writer->names, writer->names_size) &&
+             fsync(fd) == 0;
+    const int saved = errno;
+    close(fd);
+
+    if (!ok || rename(tmp, file) != 0)
+    {
+        const int failed = ok ? errno : saved;
+        unlink(tmp);
+        free(tmp);
+        errno = failed;
+        return 0; // Write failed
+    }
+
+    free(tmp);
+    return 1;
+}
+
+/**
+ * @brief Writes the path of an entry below a directory into the diff's path buffer.
+ *
+ * @return The new path length, or 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API size_t __fluent_libc_path_snapshot_set_path(
+    char **const path,
+    size_t *const cap,
+    const size_t dir_len,
+    const char *const name
+)
+{
+    const size_t name_len = strlen(name);
+    const size_t len = dir_len + (dir_len > 0) + name_len;
+    if (len + 1 > *cap)
+    {
+        size_t grown_cap = *cap * 2;
+        while (grown_cap < len + 1)
+        {
+            grown_cap *= 2;
+        }
+
+        char *grown = (char *)realloc(*path, grown_cap);
+        if (!grown)
+        {
+            return 0; // Memory allocation failed
+        }
+        *path = grown;
+        *cap = grown_cap;
+    }
+
+    size_t pos = dir_len;
+    if (dir_len > 0)
+    {
+        (*path)[pos++] = '/';
+    }
+    memcpy(*path + pos, name, name_len + 1);
+    return len;
+}
+
+/**
+ * @brief Pushes a pair of sibling ranges.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_snapshot_push_range(
+    __fluent_libc_path_snapshot_range_t **const stack,
+    size_t *const depth,
+    size_t *const cap,
+    const __fluent_libc_path_snapshot_range_t range
+)
+{
+    if (*depth == *cap)
+    {
+        const size_t grown_cap = *cap * 2;
+        __fluent_libc_path_snapshot_range_t *grown = (__fluent_libc_path_snapshot_range_t *)realloc(
+            *stack, grown_cap * sizeof(__fluent_libc_path_snapshot_range_t));
+        if (!grown)
+        {
+            return 0; // Memory allocation failed
+        }
+        *stack = grown;
+        *cap = grown_cap;
+    }
+
+    (*stack)[(*depth)++] = range;
+    return 1;
+}
+
+/**
+ * @brief Checks whether the record of an entry present in both snapshots changed.
+ *
+ * Directories compare by inode and mode only: their size and mtime follow their entries.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_snapshot_modified(
+    const path_snapshot_entry_t *const a,
+    const path_snapshot_entry_t *const b
+)
+{
+    if (a->ino != b->ino || a->mode != b->mode)
+    {
+        return 1;
+    }
+
+    return !S_ISDIR(a->mode) && (a->size != b->size || a->mtime_ns != b->mtime_ns);
+}
+#endif
+
+// ============= PUBLIC API =============
+/**
+ * @brief Walks a directory tree and writes its snapshot.
+ *
+ * @param root The directory to record (followed if it is a symbolic link). Must not be NULL or empty.
+ * @param file The snapshot file to write. It is replaced atomically.
+ * @return 1 on success, 0 on failure (errno set). The walk fails if any directory cannot be read.
+ */
+FLUENT_LIBC_PATH_API int path_snapshot_write(const char *const root, const char *const file)
+{
+    if (!root || root[0] == '\0' || !file || file[0] == '\0')
+    {
+        errno = EINVAL;
+        return 0; // Invalid arguments
+    }
+
+#ifdef _WIN32
+    errno = ENOSYS;
+    return 0; // Not supported on Windows
+#else
+    const int fd = open(root, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        const int saved = errno;
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        errno = saved;
+        return 0; // The root cannot be opened
+    }
+
+    __fluent_libc_path_snapshot_writer_t writer;
+    memset(&writer, 0, sizeof(writer));
+    writer.intern_mask = 255;
+    writer.intern = (uint32_t *)calloc(writer.intern_mask + 1, sizeof(uint32_t));
+    writer.buffer = (char *)malloc(PATH_WALK_BUFFER_SIZE);
+    if (!writer.intern || !writer.buffer)
+    {
+        free(writer.intern);
+        free(writer.buffer);
+        close(fd);
+        errno = ENOMEM;
+        return 0; // Memory allocation failed
+    }
+
+    const int ok = __fluent_libc_path_snapshot_walk(&writer, fd, &st) && __fluent_libc_path_snapshot_store(&writer, file);
+    const int saved = errno;
+    free(writer.entries);
+    free(writer.names);
+    free(writer.intern);
+    free(writer.buffer);
+    errno = saved;
+    return ok;
+#endif
+}
+
+/**
+ * @brief Maps a snapshot file and validates it.
+ *
+ * @param file The snapshot file.
+ * @param snapshot Receives the mapped snapshot.
+ * @return 1 on success, 0 on failure (errno set; EINVAL if the file is not a valid snapshot).
+ */
+FLUENT_LIBC_PATH_API int path_snapshot_open(const char *const file, path_snapshot_t *const snapshot)
+{
+    if (!file || !snapshot)
+    {
+        errno = EINVAL;
+        return 0; // Invalid arguments
+    }
+
+#ifdef _WIN32
+    errno = ENOSYS;
+    return 0; // Not supported on Windows
+#else
+    const int fd = open(file, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return 0; // Cannot open the file
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        const int saved = errno;
+        close(fd);
+        errno = saved;
+        return 0; // Cannot be measured
+    }
+
+    if ((size_t)st.st_size < sizeof(__fluent_libc_path_snapshot_header_t))
+    {
+        close(fd);
+        errno = EINVAL;
+        return 0; // Too short to be a snapshot
+    }
+
+    const size_t size = (size_t)st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return 0; // Cannot be mapped
+    }
+
+    // Check the header, then that every record stays within bounds
+    const __fluent_libc_path_snapshot_header_t *header = (const __fluent_libc_path_snapshot_header_t *)map;
+    const size_t records = (size - sizeof(*header)) / sizeof(path_snapshot_entry_t);
+    int valid = header->magic == __FLUENT_LIBC_PATH_SNAPSHOT_MAGIC &&
+                header->version == __FLUENT_LIBC_PATH_SNAPSHOT_VERSION &&
+                header->entry_size == sizeof(path_snapshot_entry_t) &&
+                header->count > 0 && header->count <= records && header->names_size > 0 &&
+                header->names_size == size - sizeof(*header) - header->count * sizeof(path_snapshot_entry_t);
+
+    const path_snapshot_entry_t *entries = (const path_snapshot_entry_t *)(header + 1);
+    const char *names = (const char *)(entries + (valid ? header->count : 0));
+    if (valid)
+    {
+        valid = names[header->names_size - 1] == '\0' && S_ISDIR(entries[0].mode) && entries[0].end == header->count;
+    }
+    for (size_t i = 0; valid && i < header->count; i++)
+    {
+        const path_snapshot_entry_t *entry = &entries[i];
+        valid = entry->name < header->names_size && entry->end > i && entry->end <= header->count &&
+                (S_ISDIR(entry->mode) || entry->end == i + 1) &&
+                (i == 0 ? entry->parent == PATH_SNAPSHOT_NO_PARENT : entry->parent < i);
+    }
+
+    if (!valid)
+    {
+        munmap(map, size);
+        errno = EINVAL;
+        return 0; // Not a snapshot (or written with the other byte order)
+    }
+
+    snapshot->entries = entries;
+    snapshot->count = (size_t)header->count;
+    snapshot->names = names;
+    snapshot->names_size = (size_t)header->names_size;
+    snapshot->map = map;
+    snapshot->map_size = size;
+    return 1;
+#endif
+}
+
+/**
+ * @brief Unmaps a snapshot.
+ *
+ * @param snapshot The snapshot to close.
+ */
+FLUENT_LIBC_PATH_API void path_snapshot_close(path_snapshot_t *const snapshot)
+{
+    if (!snapshot || !snapshot->map)
+    {
+        return;
+    }
+
+#ifndef _WIN32
+    munmap(snapshot->map, snapshot->map_size);
+#endif
+    memset(snapshot, 0, sizeof(*snapshot));
+}
+
+/**
+ * @brief Returns the name of a record (its last path component; "" for the root).
+ *
+ * @param snapshot The snapshot the record belongs to.
+ * @param entry The record.
+ * @return The NUL-terminated name.
+ */
+FLUENT_LIBC_PATH_API const char *path_snapshot_name(const path_snapshot_t *const snapshot, const path_snapshot_entry_t *const entry)
+{
+    return snapshot->names + entry->name;
+}
+
+/**
+ * @brief Reports the differences between two snapshots of the same tree.
+ *
+ * Subtrees whose directory digests match are skipped without being visited.
+ * The root itself is never reported.
+ *
+ * @param old_snapshot The earlier snapshot.
+ * @param new_snapshot The later snapshot.
+ * @param callback The function to call for every change. Must not be NULL.
+ * @param user_data Opaque pointer forwarded to the callback.
+ * @return 1 if the diff completed or was stopped by the callback, 0 on error (errno set).
+ */
+FLUENT_LIBC_PATH_API int path_snapshot_diff(
+    const path_snapshot_t *const old_snapshot,
+    const path_snapshot_t *const new_snapshot,
+    const path_snapshot_diff_callback_t callback,
+    void *const user_data
+)
+{
+    if (!old_snapshot || !new_snapshot || !callback || old_snapshot->count == 0 || new_snapshot->count == 0)
+    {
+        errno = EINVAL;
+        return 0; // Invalid arguments
+    }
+
+#ifdef _WIN32
+    (void)user_data;
+    errno = ENOSYS;
+    return 0; // Not supported on Windows
+#else
+    const path_snapshot_entry_t *old_entries = old_snapshot->entries;
+    const path_snapshot_entry_t *new_entries = new_snapshot->entries;
+    if (old_entries[0].digest == new_entries[0].digest)
+    {
+        return 1; // Nothing changed
+    }
+
+    size_t path_cap = 256;
+    size_t stack_cap = 16;
+    size_t depth = 0;
+    char *path = (char *)malloc(path_cap);
+    __fluent_libc_path_snapshot_range_t *stack =
+        (__fluent_libc_path_snapshot_range_t *)malloc(stack_cap * sizeof(__fluent_libc_path_snapshot_range_t));
+    if (!path || !stack)
+    {
+        free(path);
+        free(stack);
+        errno = ENOMEM;
+        return 0; // Memory allocation failed
+    }
+
+    const __fluent_libc_path_snapshot_range_t top = { 1, old_entries[0].end, 1, new_entries[0].end, 0, NULL };
+    stack[depth++] = top;
+    path[0] = '\0';
+
+    int ok = 1;
+    int stopped = 0;
+    path_snapshot_change_t change;
+    while (ok && !stopped && depth > 0)
+    {
+        __fluent_libc_path_snapshot_range_t *range = &stack[depth - 1];
+        const size_t dir_len = range->path_len;
+
+        // A directory that replaced an entry of another type is reported once the old one is gone
+        if (range->announce)
+        {
+            path[dir_len] = '\0';
+            change.kind = PATH_SNAPSHOT_ADDED;
+            change.path = path;
+            change.path_len = dir_len;
+            change.old_entry = NULL;
+            change.new_entry = range->announce;
+            range->announce = NULL;
+            stopped = callback(&change, user_data) != 0;
+            continue;
+        }
+
+        if (range->old_pos >= range->old_end && range->new_pos >= range->new_end)
+        {
+            depth--;
+            continue; // Both ranges done
+        }
+
+        // Merge-join by name; a missing side sorts last
+        const path_snapshot_entry_t *old_entry =
+            range->old_pos < range->old_end ? &old_entries[range->old_pos] : NULL;
+        const path_snapshot_entry_t *new_entry =
+            range->new_pos < range->new_end ? &new_entries[range->new_pos] : NULL;
+        const char *old_name = old_entry ? old_snapshot->names + old_entry->name : NULL;
+        const char *new_name = new_entry ? new_snapshot->names + new_entry->name : NULL;
+        const int cmp = !old_entry ? 1 : !new_entry ? -1 : strcmp(old_name, new_name);
+        if (cmp < 0)
+        {
+            new_entry = NULL;
+        }
+        else if (cmp > 0)
+        {
+            old_entry = NULL;
+        }
+
+        if (old_entry)
+        {
+            range->old_pos = old_entry->end;
+        }
+        if (new_entry)
+        {
+            range->new_pos = new_entry->end;
+        }
+
+        const size_t len = __fluent_libc_path_snapshot_set_path(&path, &path_cap, dir_len, old_entry ? old_name : new_name);
+        if (len == 0)
+        {
+            ok = 0;
+            break; // Memory allocation failed
+        }
+
+        change.path = path;
+        change.path_len = len;
+        change.old_entry = old_entry;
+        change.new_entry = new_entry;
+
+        // Present on both sides with the same type: compare, then descend if the digests differ
+        if (old_entry && new_entry && (old_entry->mode & S_IFMT) == (new_entry->mode & S_IFMT))
+        {
+            if (__fluent_libc_path_snapshot_modified(old_entry, new_entry))
+            {
+                change.kind = PATH_SNAPSHOT_MODIFIED;
+                stopped = callback(&change, user_data) != 0;
+            }
+
+            if (!stopped && S_ISDIR(new_entry->mode) && old_entry->digest != new_entry->digest)
+            {
+                const __fluent_libc_path_snapshot_range_t children = {
+                    (size_t)(old_entry - old_entries) + 1, old_entry->end,
+                    (size_t)(new_entry - new_entries) + 1, new_entry->end,
+                    len, NULL
+                };
+                ok = __fluent_libc_path_snapshot_push_range(&stack, &depth, &stack_cap, children);
+            }
+            continue;
+        }
+
+        // Only in one snapshot, or its type changed: removal first, then addition
+        if (new_entry)
+        {
+            const size_t first = (size_t)(new_entry - new_entries) + 1;
+            const __fluent_libc_path_snapshot_range_t added = {
+                0, 0, first, new_entry->end, len, old_entry ? new_entry : NULL
+            };
+            if (!old_entry)
+            {
+                change.kind = PATH_SNAPSHOT_ADDED;
+                stopped = callback(&change, user_data) != 0;
+            }
+
+            // The announcing range is needed even without entries when it replaces an old entry
+            if (!stopped && (first < new_entry->end || old_entry))
+            {
+                ok = __fluent_libc_path_snapshot_push_range(&stack, &depth, &stack_cap, added);
+            }
+        }
+
+        if (old_entry && ok && !stopped)
+        {
+            change.kind = PATH_SNAPSHOT_REMOVED;
+            change.new_entry = NULL;
+            stopped = callback(&change, user_data) != 0;
+
+            const size_t first = (size_t)(old_entry - old_entries) + 1;
+            const __fluent_libc_path_snapshot_range_t removed = { first, old_entry->end, 0, 0, len, NULL };
+            if (!stopped && first < old_entry->end)
+            {
+                ok = __fluent_libc_path_snapshot_push_range(&stack, &depth, &stack_cap, removed);
+            }
+        }
+    }
+
+    free(path);
+    free(stack);
+    if (!ok)
+    {
+        errno = ENOMEM;
+        return 0; // Memory allocation failed
+    }
+
+    return 1;
+#endif
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_SNAPSHOT_LIBRARY_H
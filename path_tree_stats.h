@@ -0,0 +1,656 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_TREE_STATS_LIBRARY_H
+#define FLUENT_LIBC_PATH_TREE_STATS_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Tree Statistics
+// ----------------------------------------
+// Parallel disk usage: bytes, blocks, file/directory counts and depth per subtree.
+// Provides:
+//   - path_tree_stats(root, opts)    – Walks root and returns the per-directory totals
+//   - path_tree_stats_destroy(stats) – Releases the result
+//
+// Behavior:
+//   - Directories are opened with openat() relative to their parent's fd and
+//     every entry is measured with fstatat(dirfd, name, AT_SYMLINK_NOFOLLOW),
+//     so no path is ever built. Subdirectories are handed to the work-stealing
+//     pool of path_pool.h (the calling thread included), so subtrees are
+//     measured in parallel.
+//   - Files with more than one hard link are counted once, the first time
+//     their (device, inode) is seen (see path_identity.h), as du does.
+//     PATH_TREE_STATS_COUNT_LINKS counts every link instead.
+//   - PATH_TREE_STATS_ONE_FILESYSTEM skips directories on other devices (du -x).
+//   - Symbolic links are counted as entries, never followed.
+//   - Entries that cannot be opened or measured are skipped and counted in
+//     stats->errors.
+//   - The result is a flat array in breadth-first order: nodes[0] is the root
+//     and the subdirectories of a node are contiguous, starting at first_child.
+//     opts->report_depth limits how deep directories are reported; deeper
+//     ones are still counted in their ancestors' totals.
+//
+// Memory Management:
+//   - The result is allocated by path_tree_stats() and must be released with
+//     path_tree_stats_destroy(). Node names point into the result.
+//
+// Dependencies:
+//   - POSIX: <pthread.h>, openat/fstatat, path_walk.h, path_identity.h, path_pool.h
+//   - Windows: not supported, path_tree_stats() returns NULL
+//
+// Example:
+// ----------------------------------------
+//   path_tree_stats_opts_t opts = { 0, 0, 1 }; // All CPUs, du semantics, root and its children
+//   path_tree_stats_t *stats = path_tree_stats("/home", &opts);
+//   if (stats)
+//   {
+//       const path_tree_stats_node_t *root = &stats->nodes[0];
+//       for (size_t i = 0; i < root->child_count; i++)
+//       {
+//           const path_tree_stats_node_t *user = &stats->nodes[root->first_child + i];
+//           printf("%-16s %12llu bytes %8llu files\n", user->name,
+//                  (unsigned long long)user->totals.bytes, (unsigned long long)user->totals.files);
+//       }
+//       path_tree_stats_destroy(stats);
+//   }
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include "path_atomic.h"   // For the open counters
+#include "path_identity.h" // For the hard link set
+#include "path_pool.h"     // For the worker threads
+#include "path_walk.h"     // For path_dir_reader_t
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#   include <fcntl.h>     // For openat and O_* flags
+#   include <pthread.h>   // For the hard link set lock
+#   include <sys/stat.h>  // For fstatat
+#endif
+
+// ============= MACROS =============
+#define PATH_TREE_STATS_NONE ((size_t)-1) // Parent index of the root
+
+// ============= TYPES =============
+/**
+ * @brief Options for path_tree_stats().
+ */
+typedef enum
+{
+    PATH_TREE_STATS_COUNT_LINKS = 1 << 0,    // Count every hard link instead of every inode once
+    PATH_TREE_STATS_ONE_FILESYSTEM = 1 << 1, // Do not descend into other filesystems
+} path_tree_stats_flags_t;
+
+/**
+ * @brief Parameters of path_tree_stats().
+ */
+typedef struct
+{
+    size_t threads;      // Number of worker threads, or 0 for one per online CPU
+    int flags;           // A combination of path_tree_stats_flags_t values
+    size_t report_depth; // Deepest directory level reported (0 = root only, PATH_TREE_STATS_NONE = all)
+} path_tree_stats_opts_t;
+
+/**
+ * @brief Totals of a subtree.
+ */
+typedef struct
+{
+    uint64_t bytes;   // Sum of st_size
+    uint64_t blocks;  // Sum of st_blocks (512-byte units)
+    uint64_t files;   // Entries that are not directories
+    uint64_t dirs;    // Directories, this one included
+    size_t max_depth; // Depth of the deepest entry below this directory (0 if empty)
+} path_tree_totals_t;
+
+/**
+ * @brief One reported directory.
+ */
+typedef struct
+{
+    const char *name;          // Name in the parent (the root path as given for the root)
+    size_t parent;             // Index of the parent, or PATH_TREE_STATS_NONE for the root
+    size_t first_child;        // Index of the first reported subdirectory
+    size_t child_count;        // Number of reported subdirectories (contiguous from first_child)
+    path_tree_totals_t totals; // Totals of the whole subtree
+} path_tree_stats_node_t;
+
+/**
+ * @brief The result of path_tree_stats().
+ */
+typedef struct
+{
+    path_tree_stats_node_t *nodes; // nodes[0] is the root, then breadth-first order
+    size_t count;                  // Number of nodes
+    size_t errors;                 // Entries that could not be opened or measured
+    char *names;                   // Storage for the node names
+} path_tree_stats_t;
+
+#ifndef _WIN32
+/**
+ * @brief A directory while it is being measured.
+ */
+typedef struct __fluent_libc_path_stats_dir
+{
+    struct __fluent_libc_path_stats_dir *parent;   // Containing directory (NULL for the root)
+    struct __fluent_libc_path_stats_dir *children; // Subdirectories (written by this directory's scanner only)
+    struct __fluent_libc_path_stats_dir *sibling;  // Next subdirectory of the parent
+    int fd;                                        // Open fd, closed once every subdirectory has opened its own
+    size_t opening;                                // 1 for its own scan + 1 per subdirectory not yet opened (atomic)
+    size_t depth;                                  // Depth below the root
+    size_t index;                                  // Position in the result (while flattening)
+    path_tree_totals_t own;                        // Entries directly inside, then the subtree (after the walk)
+    size_t name_len;                               // Length of name
+    char name[];                                   // Name in the parent (the root path for the root)
+} __fluent_libc_path_stats_dir_t;
+
+/**
+ * @brief State shared by the workers of one path_tree_stats() call.
+ */
+typedef struct
+{
+    char *buffers;                           // One getdents64 buffer per worker
+    pthread_mutex_t links_lock;              // Guards links
+    path_id_cache_t links;                   // Inodes with several links already counted
+    size_t errors;                           // Entries that could not be opened or measured (atomic)
+    int flags;                               // path_tree_stats_flags_t values
+    dev_t root_dev;                          // Device of the root (for PATH_TREE_STATS_ONE_FILESYSTEM)
+} __fluent_libc_path_stats_state_t;
+#endif
+
+// ============= HELPERS =============
+#ifndef _WIN32
+/**
+ * @brief Allocates a directory node.
+ *
+ * @return The node, or NULL if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API __fluent_libc_path_stats_dir_t *__fluent_libc_path_stats_dir_new(
+    __fluent_libc_path_stats_dir_t *const parent,
+    const char *const name,
+    const size_t len
+)
+{
+    __fluent_libc_path_stats_dir_t *dir =
+        (__fluent_libc_path_stats_dir_t *)calloc(1, sizeof(__fluent_libc_path_stats_dir_t) + len + 1);
+    if (!dir)
+    {
+        return NULL; // Memory allocation failed
+    }
+
+    dir->parent = parent;
+    dir->fd = -1;
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&dir->opening, 1, __ATOMIC_RELAXED);
+    dir->depth = parent ? parent->depth + 1 : 0;
+    dir->name_len = len;
+    memcpy(dir->name, name, len);
+    dir->name[len] = '\0';
+    return dir;
+}
+
+/**
+ * @brief Drops one open reference; closes the directory fd when no subdirectory needs it anymore.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_stats_release(__fluent_libc_path_stats_dir_t *const dir)
+{
+    if (__FLUENT_LIBC_PATH_ATOMIC_SUB(&dir->opening, 1, __ATOMIC_ACQ_REL) == 1 && dir->fd >= 0)
+    {
+        close(dir->fd);
+        dir->fd = -1;
+    }
+}
+
+/**
+ * @brief Checks whether a multiply-linked inode was already counted, and marks it.
+ *
+ * @return 1 if it must be counted now, 0 if it was seen before.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_stats_first_link(__fluent_libc_path_stats_state_t *const state, const struct stat *const st)
+{
+    path_id_t id;
+    id.dev = (uint64_t)st->st_dev;
+    id.ino = (uint64_t)st->st_ino;
+
+    pthread_mutex_lock(&state->links_lock);
+    const int inserted = path_id_cache_insert(&state->links, id);
+    pthread_mutex_unlock(&state->links_lock);
+    return inserted != 0; // On allocation failure (-1), count it rather than lose it
+}
+
+/**
+ * @brief Pool process hook: measures the entries directly inside one directory and queues its subdirectories.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_stats_scan(
+    __fluent_libc_path_pool_t *const pool,
+    const size_t worker,
+    void *const item
+)
+{
+    __fluent_libc_path_stats_state_t *state = (__fluent_libc_path_stats_state_t *)pool->user_data;
+    __fluent_libc_path_stats_dir_t *dir = (__fluent_libc_path_stats_dir_t *)item;
+    char *buffer = state->buffers + worker * PATH_WALK_BUFFER_SIZE;
+
+    // Open relative to the parent (the root is opened by the caller),
+    // then let the parent close its fd if it was the last one
+    if (dir->parent)
+    {
+        dir->fd = openat(dir->parent->fd, dir->name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+        __fluent_libc_path_stats_release(dir->parent);
+    }
+
+    struct stat st;
+    if (dir->fd < 0 || fstat(dir->fd, &st) != 0)
+    {
+        __FLUENT_LIBC_PATH_ATOMIC_ADD(&state->errors, 1, __ATOMIC_RELAXED);
+        __fluent_libc_path_stats_release(dir);
+        return; // Cannot be opened
+    }
+
+    dir->own.dirs = 1;
+    dir->own.bytes = (uint64_t)st.st_size;
+    dir->own.blocks = (uint64_t)st.st_blocks;
+
+    // The reader owns the fd it is given; keep dir->fd open for the subdirectories
+#ifdef __linux__
+    const int read_fd = dir->fd;
+#else
+    const int read_fd = dup(dir->fd);
+#endif
+    path_dir_reader_t reader;
+    if (read_fd < 0 || !path_dir_reader_open(&reader, read_fd, buffer, PATH_WALK_BUFFER_SIZE))
+    {
+        __FLUENT_LIBC_PATH_ATOMIC_ADD(&state->errors, 1, __ATOMIC_RELAXED);
+        __fluent_libc_path_stats_release(dir);
+        return; // Cannot be read
+    }
+
+    const char *name;
+    size_t name_len;
+    path_walk_type_t type;
+    int status;
+    while ((status = path_dir_reader_next(&reader, &name, &name_len, &type)) > 0)
+    {
+        if (fstatat(dir->fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+        {
+            if (errno != ENOENT)
+            {
+                __FLUENT_LIBC_PATH_ATOMIC_ADD(&state->errors, 1, __ATOMIC_RELAXED);
+            }
+            continue; // Removed meanwhile, or not accessible
+        }
+
+        dir->own.max_depth = 1;
+        if (!S_ISDIR(st.st_mode))
+        {
+            if (st.st_nlink > 1 && !(state->flags & PATH_TREE_STATS_COUNT_LINKS) &&
+                !__fluent_libc_path_stats_first_link(state, &st))
+            {
+                continue; // Another link to a file already counted
+            }
+
+            dir->own.files++;
+            dir->own.bytes += (uint64_t)st.st_size;
+            dir->own.blocks += (uint64_t)st.st_blocks;
+            continue;
+        }
+
+        if ((state->flags & PATH_TREE_STATS_ONE_FILESYSTEM) && st.st_dev != state->root_dev)
+        {
+            continue; // Mount point
+        }
+
+        __fluent_libc_path_stats_dir_t *child = __fluent_libc_path_stats_dir_new(dir, name, name_len);
+        if (!child)
+        {
+            __FLUENT_LIBC_PATH_ATOMIC_ADD(&state->errors, 1, __ATOMIC_RELAXED);
+            continue; // Memory allocation failed
+        }
+
+        child->sibling = dir->children;
+        dir->children = child;
+        __FLUENT_LIBC_PATH_ATOMIC_ADD(&dir->opening, 1, __ATOMIC_RELAXED);
+        if (!__fluent_libc_path_pool_push(pool, worker, child))
+        {
+            // Keep the node in the tree (it is freed with it) but do not measure it
+            __FLUENT_LIBC_PATH_ATOMIC_ADD(&state->errors, 1, __ATOMIC_RELAXED);
+            __fluent_libc_path_stats_release(dir);
+        }
+    }
+
+    if (status < 0)
+    {
+        __FLUENT_LIBC_PATH_ATOMIC_ADD(&state->errors, 1, __ATOMIC_RELAXED);
+    }
+
+#ifndef __linux__
+    path_dir_reader_close(&reader);
+#endif
+
+    __fluent_libc_path_stats_release(dir); // The scan itself is done
+}
+
+/**
+ * @brief Folds every directory's totals into its ancestors and frees the nodes that are not reported.
+ *
+ * Iterative post-order traversal, so deep trees do not exhaust the stack.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_stats_fold(__fluent_libc_path_stats_dir_t *const root, const size_t report_depth)
+{
+    size_t cap = 64;
+    size_t top = 0;
+    __fluent_libc_path_stats_dir_t **stack = (__fluent_libc_path_stats_dir_t **)malloc(cap * sizeof(*stack));
+    if (!stack)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    // Pre-order onto a list, then fold it backwards: children always come after their parent
+    __fluent_libc_path_stats_dir_t **order = NULL;
+    size_t order_count = 0;
+    size_t order_cap = 0;
+    stack[top++] = root;
+    while (top > 0)
+    {
+        __fluent_libc_path_stats_dir_t *dir = stack[--top];
+        if (order_count == order_cap)
+        {
+            order_cap = order_cap ? order_cap * 2 : 256;
+            __fluent_libc_path_stats_dir_t **grown =
+                (__fluent_libc_path_stats_dir_t **)realloc(order, order_cap * sizeof(*order));
+            if (!grown)
+            {
+                free(order);
+                free(stack);
+                return 0; // Memory allocation failed
+            }
+            order = grown;
+        }
+        order[order_count++] = dir;
+
+        for (__fluent_libc_path_stats_dir_t *child = dir->children; child; child = child->sibling)
+        {
+            if (top == cap)
+            {
+                cap *= 2;
+                __fluent_libc_path_stats_dir_t **grown =
+                    (__fluent_libc_path_stats_dir_t **)realloc(stack, cap * sizeof(*stack));
+                if (!grown)
+                {
+                    free(order);
+                    free(stack);
+                    return 0; // Memory allocation failed
+                }
+                stack = grown;
+            }
+            stack[top++] = child;
+        }
+    }
+    free(stack);
+
+    for (size_t i = order_count; i-- > 1;)
+    {
+        __fluent_libc_path_stats_dir_t *dir = order[i];
+        path_tree_totals_t *up = &dir->parent->own;
+        up->bytes += dir->own.bytes;
+        up->blocks += dir->own.blocks;
+        up->files += dir->own.files;
+        up->dirs += dir->own.dirs;
+        if (dir->own.max_depth + 1 > up->max_depth)
+        {
+            up->max_depth = dir->own.max_depth + 1;
+        }
+
+        // Below the reported depth the children are no longer needed
+        if (dir->depth > report_depth)
+        {
+            free(dir);
+        }
+        else if (dir->depth == report_depth)
+        {
+            dir->children = NULL; // Already freed (they come after it in the order)
+        }
+    }
+    if (report_depth == 0)
+    {
+        root->children = NULL;
+    }
+
+    free(order);
+    return 1;
+}
+
+/**
+ * @brief Frees a tree of directory nodes (without recursion).
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_stats_free_dirs(__fluent_libc_path_stats_dir_t *const root)
+{
+    __fluent_libc_path_stats_dir_t *pending = root;
+    while (pending)
+    {
+        __fluent_libc_path_stats_dir_t *dir = pending;
+        pending = dir->sibling;
+
+        // Splice the children into the pending list
+        __fluent_libc_path_stats_dir_t *child = dir->children;
+        while (child)
+        {
+            __fluent_libc_path_stats_dir_t *next = child->sibling;
+            child->sibling = pending;
+            pending = child;
+            child = next;
+        }
+
+        if (dir->fd >= 0)
+        {
+            close(dir->fd); // Never scanned
+        }
+        free(dir);
+    }
+}
+
+/**
+ * @brief Lays out the reported directories breadth-first into the result.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_stats_flatten(__fluent_libc_path_stats_dir_t *const root, path_tree_stats_t *const stats)
+{
+    // Count the nodes and the name bytes (depth-first, following the parent links back up)
+    size_t count = 0;
+    size_t name_bytes = 0;
+    const __fluent_libc_path_stats_dir_t *dir = root;
+    while (dir)
+    {
+        count++;
+        name_bytes += dir->name_len + 1;
+        if (dir->children)
+        {
+            dir = dir->children;
+            continue;
+        }
+
+        while (dir && !dir->sibling)
+        {
+            dir = dir->parent;
+        }
+        dir = dir ? dir->sibling : NULL;
+    }
+
+    __fluent_libc_path_stats_dir_t **queue = (__fluent_libc_path_stats_dir_t **)malloc(count * sizeof(*queue));
+    stats->nodes = (path_tree_stats_node_t *)malloc(count * sizeof(path_tree_stats_node_t));
+    stats->names = (char *)malloc(name_bytes);
+    if (!queue || !stats->nodes || !stats->names)
+    {
+        free(queue);
+        return 0; // Memory allocation failed
+    }
+
+    // The queue doubles as the result order: the children of a node are enqueued together
+    size_t head = 0;
+    size_t tail = 0;
+    size_t name_pos = 0;
+    root->index = 0;
+    queue[tail++] = root;
+    while (head < tail)
+    {
+        __fluent_libc_path_stats_dir_t *current = queue[head];
+        path_tree_stats_node_t *node = &stats->nodes[head];
+        head++;
+
+        memcpy(stats->names + name_pos, current->name, current->name_len + 1);
+        node->name = stats->names + name_pos;
+        name_pos += current->name_len + 1;
+        node->parent = current->parent ? current->parent->index : PATH_TREE_STATS_NONE;
+        node->first_child = tail;
+        node->child_count = 0;
+        node->totals = current->own;
+
+        for (__fluent_libc_path_stats_dir_t *child = current->children; child; child = child->sibling)
+        {
+            child->index = tail;
+            queue[tail++] = child;
+            node->child_count++;
+        }
+    }
+
+    stats->count = count;
+    free(queue);
+    return 1;
+}
+#endif
+
+// ============= PUBLIC API =============
+/**
+ * @brief Releases a result of path_tree_stats().
+ *
+ * @param stats The result (may be NULL).
+ */
+FLUENT_LIBC_PATH_API void path_tree_stats_destroy(path_tree_stats_t *const stats)
+{
+    if (!stats)
+    {
+        return;
+    }
+
+    free(stats->nodes);
+    free(stats->names);
+    free(stats);
+}
+
+/**
+ * @brief Measures a directory tree in parallel.
+ *
+ * @param root The directory to measure. Must not be NULL or empty.
+ * @param opts The options, or NULL for all CPUs, du semantics and every directory reported.
+ * @return The per-directory totals, or NULL if root cannot be opened or memory allocation
+ *         failed (errno set). Release it with path_tree_stats_destroy().
+ */
+FLUENT_LIBC_PATH_API path_tree_stats_t *path_tree_stats(const char *const root, const path_tree_stats_opts_t *const opts)
+{
+    if (!root || root[0] == '\0')
+    {
+        errno = EINVAL;
+        return NULL; // Invalid path
+    }
+
+#ifdef _WIN32
+    (void)opts;
+    return NULL; // Not supported on Windows
+#else
+    // Symbolic links are followed for the root only
+    const int fd = open(root, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return NULL; // The root cannot be opened
+    }
+
+    __fluent_libc_path_stats_state_t state;
+    pthread_mutex_init(&state.links_lock, NULL);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&state.errors, 0, __ATOMIC_RELAXED);
+    state.flags = opts ? opts->flags : 0;
+    state.root_dev = st.st_dev;
+    state.links.slots = NULL;
+    state.buffers = NULL;
+
+    path_tree_stats_t *stats = (path_tree_stats_t *)calloc(1, sizeof(path_tree_stats_t));
+    __fluent_libc_path_stats_dir_t *top = __fluent_libc_path_stats_dir_new(NULL, root, strlen(root));
+    if (!top)
+    {
+        close(fd);
+    }
+    else
+    {
+        top->fd = fd;
+    }
+
+    __fluent_libc_path_pool_t pool;
+    const int pool_ready = stats && top && __fluent_libc_path_pool_init(
+        &pool, opts ? opts->threads : 0, __fluent_libc_path_stats_scan, NULL, NULL, &state);
+    if (pool_ready)
+    {
+        state.buffers = (char *)malloc(pool.threads * PATH_WALK_BUFFER_SIZE);
+    }
+
+    // The root goes to the calling thread, which is worker 0
+    int ok = state.buffers && path_id_cache_init(&state.links) && __fluent_libc_path_pool_push(&pool, 0, top);
+    if (ok)
+    {
+        __fluent_libc_path_pool_run(&pool);
+
+        stats->errors = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&state.errors, __ATOMIC_RELAXED);
+        const size_t report_depth = opts ? opts->report_depth : PATH_TREE_STATS_NONE;
+        ok = __fluent_libc_path_stats_fold(top, report_depth) && __fluent_libc_path_stats_flatten(top, stats);
+    }
+
+    if (pool_ready)
+    {
+        __fluent_libc_path_pool_destroy(&pool);
+    }
+    if (state.links.slots)
+    {
+        path_id_cache_destroy(&state.links);
+    }
+    free(state.buffers);
+    pthread_mutex_destroy(&state.links_lock);
+    __fluent_libc_path_stats_free_dirs(top);
+
+    if (!ok)
+    {
+        path_tree_stats_destroy(stats);
+        errno = ENOMEM;
+        return NULL; // Memory allocation failed
+    }
+
+    return stats;
+#endif
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_TREE_STATS_LIBRARY_H
@@ -0,0 +1,768 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_WALK_LIBRARY_H
+#define FLUENT_LIBC_PATH_WALK_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Recursive Directory Walker
+// ----------------------------------------
+// Depth-first traversal of a directory tree that yields normalized paths.
+// Provides:
+//   - path_walk(root, flags, callback, user_data) – Visits every entry below root
+//
+// Behavior:
+//   - The root is resolved once through get_real_path_buff; every child path is
+//     built incrementally (append name, pop on return) in one reusable buffer,
+//     so entries are already normalized and never passed through realpath.
+//   - Directories are opened with openat() relative to their parent's fd.
+//   - On Linux entries are read with getdents64 into a large buffer; other
+//     POSIX systems fall back to fdopendir/readdir.
+//   - The entry type comes from d_type; fstatat is only issued when the
+//     filesystem reports DT_UNKNOWN.
+//   - With PATH_WALK_FOLLOW_LINKS, the (device, inode) of every directory on
+//     the current descent path is kept; a link leading back to one of them
+//     is reported but not descended, so link cycles cannot recurse forever.
+//
+// Memory Management:
+//   - The entry passed to the callback (including its path) is only valid for
+//     the duration of the callback. Copy it if it must outlive the call.
+//   - No allocation is performed per entry.
+//
+// Dependencies:
+//   - POSIX: <dirent.h>, <fcntl.h>, <sys/stat.h> & openat/fstatat
+//   - Linux: <sys/syscall.h> & getdents64
+//   - Windows: not supported, path_walk() returns 0
+//
+// Example:
+// ----------------------------------------
+//   static int print_entry(const path_walk_entry_t *entry, void *user_data)
+//   {
+//       printf("%s\n", entry->path);
+//       return PATH_WALK_CONTINUE;
+//   }
+//
+//   path_walk("./src", 0, print_entry, NULL);
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path.h"
+#include <errno.h>
+#include <limits.h> // For PATH_MAX
+#include <string.h>
+#ifndef _WIN32
+#   include <dirent.h>   // For DT_* constants and the readdir fallback
+#   include <fcntl.h>    // For openat and O_* flags
+#   include <sys/stat.h> // For fstatat
+#   ifdef __linux__
+#       include <sys/syscall.h> // For SYS_getdents64
+#   endif
+#endif
+
+// ============= MACROS =============
+#ifndef PATH_WALK_BUFFER_SIZE
+#   define PATH_WALK_BUFFER_SIZE (64 * 1024) // Size of the getdents64 buffer per directory level
+#endif
+
+#ifndef PATH_WALK_INITIAL_PATH_CAPACITY
+#   define PATH_WALK_INITIAL_PATH_CAPACITY 4096 // Initial capacity of the shared path buffer
+#endif
+
+// ============= TYPES =============
+/**
+ * @brief The type of a directory entry, mirroring the DT_* constants.
+ */
+typedef enum
+{
+    PATH_WALK_TYPE_UNKNOWN = 0,
+    PATH_WALK_TYPE_FIFO = 1,
+    PATH_WALK_TYPE_CHR = 2,
+    PATH_WALK_TYPE_DIR = 4,
+    PATH_WALK_TYPE_BLK = 6,
+    PATH_WALK_TYPE_REG = 8,
+    PATH_WALK_TYPE_LNK = 10,
+    PATH_WALK_TYPE_SOCK = 12
+} path_walk_type_t;
+
+/**
+ * @brief Values a walk callback may return to steer the traversal.
+ */
+typedef enum
+{
+    PATH_WALK_CONTINUE = 0, // Keep walking (and descend if the entry is a directory)
+    PATH_WALK_SKIP = 1,     // Do not descend into this directory
+    PATH_WALK_STOP = 2      // Abort the whole walk
+} path_walk_action_t;
+
+/**
+ * @brief Flags accepted by path_walk().
+ */
+typedef enum
+{
+    PATH_WALK_FOLLOW_LINKS = 1 << 0, // Descend into symbolic links that point to directories
+    PATH_WALK_POST_ORDER = 1 << 1,   // Report directories again after their children were visited
+    PATH_WALK_SAME_DEVICE = 1 << 2   // Do not cross into other filesystems
+} path_walk_flags_t;
+
+/**
+ * @brief A single entry reported by path_walk().
+ */
+typedef struct
+{
+    const char *path;      // Full normalized path of the entry (NUL-terminated)
+    size_t path_len;       // Length of path in bytes
+    const char *name;      // Final component of path (points into path)
+    size_t name_len;       // Length of name in bytes
+    path_walk_type_t type; // Entry type as reported by the filesystem
+    size_t depth;          // Depth below the root (direct children are at depth 1)
+    int parent_fd;         // Open fd of the containing directory, usable with *at() calls
+    int post_order;        // 1 when a directory is reported after its children
+} path_walk_entry_t;
+
+/**
+ * @brief Callback invoked for every entry. Returns a path_walk_action_t.
+ */
+typedef int (*path_walk_callback_t)(const path_walk_entry_t *entry, void *user_data);
+
+#ifndef _WIN32
+/**
+ * @brief Reads entries out of an open directory fd in large batches.
+ *
+ * On Linux this wraps getdents64 directly; on other POSIX systems it
+ * wraps a DIR stream obtained through fdopendir.
+ */
+typedef struct
+{
+    int fd;        // Directory fd being read
+#ifdef __linux__
+    char *buffer;  // getdents64 buffer
+    size_t size;   // Capacity of the buffer
+    size_t pos;    // Current offset into the buffer
+    size_t end;    // Number of valid bytes in the buffer
+#else
+    DIR *dir;      // Directory stream owning fd
+#endif
+} path_dir_reader_t;
+
+#ifdef __linux__
+/**
+ * @brief Layout of the records returned by getdents64.
+ */
+struct __fluent_libc_path_dirent64
+{
+    unsigned long long d_ino;
+    long long d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+#endif
+
+// ============= DIRECTORY READER =============
+/**
+ * @brief Initializes a directory reader over an open directory fd.
+ *
+ * The reader takes ownership of the fd; it is closed by path_dir_reader_close().
+ *
+ * @param reader The reader to initialize. Must not be NULL.
+ * @param fd An open directory fd.
+ * @param buffer Scratch memory for getdents64 (unused by the readdir fallback).
+ * @param size Size of the scratch memory in bytes.
+ * @return 1 on success, 0 on failure (the fd is closed on failure).
+ */
+FLUENT_LIBC_PATH_API int path_dir_reader_open(path_dir_reader_t *const reader, const int fd, char *const buffer, const size_t size)
+{
+    reader->fd = fd;
+#ifdef __linux__
+    reader->buffer = buffer;
+    reader->size = size;
+    reader->pos = 0;
+    reader->end = 0;
+    return 1;
+#else
+    (void)buffer;
+    (void)size;
+
+    // Wrap the fd in a DIR stream for readdir
+    reader->dir = fdopendir(fd);
+    if (!reader->dir)
+    {
+        close(fd);
+        return 0; // Failed to open the directory stream
+    }
+
+    return 1;
+#endif
+}
+
+/**
+ * @brief Reads the next entry from a directory reader, skipping "." and "..".
+ *
+ * @param reader The reader to read from.
+ * @param name Receives a pointer to the entry name (valid until the next call).
+ * @param name_len Receives the length of the entry name.
+ * @param type Receives the entry type as reported by the filesystem.
+ * @return 1 if an entry was read, 0 at the end of the directory, -1 on error.
+ */
+FLUENT_LIBC_PATH_API int path_dir_reader_next(
+    path_dir_reader_t *const reader,
+    const char **const name,
+    size_t *const name_len,
+    path_walk_type_t *const type
+)
+{
+#ifdef __linux__
+    for (;;)
+    {
+        // Refill the buffer once it has been consumed
+        if (reader->pos >= reader->end)
+        {
+            const long n = syscall(SYS_getdents64, reader->fd, reader->buffer, reader->size);
+            if (n < 0)
+            {
+                return -1; // Failed to read the directory
+            }
+
+            if (n == 0)
+            {
+                return 0; // End of the directory
+            }
+
+            reader->pos = 0;
+            reader->end = (size_t)n;
+        }
+
+        // Decode the current record and advance past it
+        const struct __fluent_libc_path_dirent64 *ent =
+            (const struct __fluent_libc_path_dirent64 *)(reader->buffer + reader->pos);
+        reader->pos += ent->d_reclen;
+
+        // Skip the "." and ".." entries
+        const char *d_name = ent->d_name;
+        if (d_name[0] == '.' && (d_name[1] == '\0' || (d_name[1] == '.' && d_name[2] == '\0')))
+        {
+            continue;
+        }
+
+        *name = d_name;
+        *name_len = strlen(d_name);
+        *type = (path_walk_type_t)ent->d_type;
+        return 1;
+    }
+#else
+    for (;;)
+    {
+        // Read the next entry, distinguishing the end of the stream from errors
+        errno = 0;
+        const struct dirent *ent = readdir(reader->dir);
+        if (!ent)
+        {
+            return errno ? -1 : 0;
+        }
+
+        // Skip the "." and ".." entries
+        const char *d_name = ent->d_name;
+        if (d_name[0] == '.' && (d_name[1] == '\0' || (d_name[1] == '.' && d_name[2] == '\0')))
+        {
+            continue;
+        }
+
+        *name = d_name;
+        *name_len = strlen(d_name);
+#   ifdef DT_UNKNOWN
+        *type = (path_walk_type_t)ent->d_type;
+#   else
+        *type = PATH_WALK_TYPE_UNKNOWN;
+#   endif
+        return 1;
+    }
+#endif
+}
+
+/**
+ * @brief Closes a directory reader and its fd.
+ *
+ * The scratch buffer is not freed; it belongs to whoever passed it in.
+ *
+ * @param reader The reader to close.
+ */
+FLUENT_LIBC_PATH_API void path_dir_reader_close(path_dir_reader_t *const reader)
+{
+#ifdef __linux__
+    close(reader->fd);
+#else
+    closedir(reader->dir);
+#endif
+}
+
+/**
+ * @brief Converts a st_mode value into a path_walk_type_t.
+ *
+ * @param mode The st_mode value.
+ * @return The matching entry type.
+ */
+FLUENT_LIBC_PATH_API path_walk_type_t path_walk_type_from_mode(const mode_t mode)
+{
+    if (S_ISREG(mode)) return PATH_WALK_TYPE_REG;
+    if (S_ISDIR(mode)) return PATH_WALK_TYPE_DIR;
+    if (S_ISLNK(mode)) return PATH_WALK_TYPE_LNK;
+    if (S_ISCHR(mode)) return PATH_WALK_TYPE_CHR;
+    if (S_ISBLK(mode)) return PATH_WALK_TYPE_BLK;
+    if (S_ISFIFO(mode)) return PATH_WALK_TYPE_FIFO;
+    if (S_ISSOCK(mode)) return PATH_WALK_TYPE_SOCK;
+    return PATH_WALK_TYPE_UNKNOWN;
+}
+
+// ============= WALKER =============
+/**
+ * @brief The identity of a directory, for link cycle detection.
+ */
+typedef struct
+{
+    dev_t dev; // st_dev
+    ino_t ino; // st_ino
+} __fluent_libc_path_walk_id_t;
+
+/**
+ * @brief Internal state shared by every level of a walk.
+ */
+typedef struct
+{
+    char *path;                   // Shared path buffer
+    size_t path_len;              // Current length of the path in the buffer
+    size_t path_cap;              // Capacity of the path buffer
+    char **buffers;               // getdents64 buffers, one per depth, reused across siblings
+    size_t buffers_len;           // Number of allocated depth buffers
+    int flags;                    // path_walk_flags_t
+    dev_t root_dev;               // Device of the root (for PATH_WALK_SAME_DEVICE)
+    __fluent_libc_path_walk_id_t *ancestors; // Directories on the current descent path, by depth (PATH_WALK_FOLLOW_LINKS)
+    size_t ancestors_len;         // Number of allocated ancestor slots
+    path_walk_callback_t callback;
+    void *user_data;
+} __fluent_libc_path_walk_state_t;
+
+/**
+ * @brief Appends "/name" to the shared path buffer, growing it if needed.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_walk_push(
+    __fluent_libc_path_walk_state_t *const state,
+    const char *const name,
+    const size_t name_len
+)
+{
+    // Avoid doubling the separator when the root is "/"
+    const size_t sep = state->path_len > 0 && state->path[state->path_len - 1] == PATH_SEPARATOR ? 0 : 1;
+    const size_t needed = state->path_len + sep + name_len + 1;
+
+    // Grow the buffer geometrically if the new component does not fit
+    if (needed > state->path_cap)
+    {
+        size_t new_cap = state->path_cap * 2;
+        while (new_cap < needed)
+        {
+            new_cap *= 2;
+        }
+
+        char *new_path = (char *)realloc(state->path, new_cap);
+        if (!new_path)
+        {
+            return 0; // Memory allocation failed
+        }
+
+        state->path = new_path;
+        state->path_cap = new_cap;
+    }
+
+    // Append the separator and the component
+    if (sep)
+    {
+        state->path[state->path_len++] = PATH_SEPARATOR;
+    }
+    memcpy(state->path + state->path_len, name, name_len);
+    state->path_len += name_len;
+    state->path[state->path_len] = '\0';
+    return 1;
+}
+
+/**
+ * @brief Returns the getdents64 buffer for a given depth, allocating it on first use.
+ *
+ * @return The buffer, or NULL if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API char *__fluent_libc_path_walk_buffer(__fluent_libc_path_walk_state_t *const state, const size_t depth)
+{
+#ifdef __linux__
+    // Grow the per-depth table if this level was never reached before
+    if (depth >= state->buffers_len)
+    {
+        const size_t new_len = depth + 8;
+        char **new_buffers = (char **)realloc(state->buffers, new_len * sizeof(char *));
+        if (!new_buffers)
+        {
+            return NULL; // Memory allocation failed
+        }
+
+        memset(new_buffers + state->buffers_len, 0, (new_len - state->buffers_len) * sizeof(char *));
+        state->buffers = new_buffers;
+        state->buffers_len = new_len;
+    }
+
+    // Allocate the buffer lazily
+    if (!state->buffers[depth])
+    {
+        state->buffers[depth] = (char *)malloc(PATH_WALK_BUFFER_SIZE);
+    }
+
+    return state->buffers[depth];
+#else
+    (void)state;
+    (void)depth;
+    return (char *)1; // Unused by the readdir fallback
+#endif
+}
+
+/**
+ * @brief Records a directory about to be descended at a given depth, unless it is already on the descent path.
+ *
+ * @param state The walk state.
+ * @param depth The depth of the directory (the root is 0).
+ * @param st The directory's metadata.
+ * @return 1 if it was recorded, 0 if it is one of its own ancestors (a link cycle),
+ *         -1 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_walk_enter(
+    __fluent_libc_path_walk_state_t *const state,
+    const size_t depth,
+    const struct stat *const st
+)
+{
+    for (size_t i = 0; i < depth; i++)
+    {
+        if (state->ancestors[i].dev == st->st_dev && state->ancestors[i].ino == st->st_ino)
+        {
+            return 0; // Already being walked above
+        }
+    }
+
+    if (depth >= state->ancestors_len)
+    {
+        const size_t new_len = depth + 16;
+        __fluent_libc_path_walk_id_t *ancestors =
+            (__fluent_libc_path_walk_id_t *)realloc(state->ancestors, new_len * sizeof(__fluent_libc_path_walk_id_t));
+        if (!ancestors)
+        {
+            return -1; // Memory allocation failed
+        }
+
+        state->ancestors = ancestors;
+        state->ancestors_len = new_len;
+    }
+
+    state->ancestors[depth].dev = st->st_dev;
+    state->ancestors[depth].ino = st->st_ino;
+    return 1;
+}
+
+/**
+ * @brief Walks the directory open at fd, whose path is currently in the shared buffer.
+ *
+ * @return PATH_WALK_CONTINUE when done, PATH_WALK_STOP if the walk was aborted,
+ *         or -1 on error (errno is set).
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_walk_dir(
+    __fluent_libc_path_walk_state_t *const state,
+    const int fd,
+    const size_t depth
+)
+{
+    // Get the scratch buffer for this level
+    char *buffer = __fluent_libc_path_walk_buffer(state, depth);
+    if (!buffer)
+    {
+        close(fd);
+        return -1; // Memory allocation failed
+    }
+
+    path_dir_reader_t reader;
+    if (!path_dir_reader_open(&reader, fd, buffer, PATH_WALK_BUFFER_SIZE))
+    {
+        return -1; // Failed to open the directory
+    }
+
+    const size_t base_len = state->path_len;
+    const char *name;
+    size_t name_len;
+    path_walk_type_t type;
+    int result = PATH_WALK_CONTINUE;
+    int read;
+
+    while ((read = path_dir_reader_next(&reader, &name, &name_len, &type)) > 0)
+    {
+        // Append the child name to the shared path
+        if (!__fluent_libc_path_walk_push(state, name, name_len))
+        {
+            result = -1; // Memory allocation failed
+            break;
+        }
+
+        // Fall back to fstatat only when the filesystem did not report a type
+        struct stat st;
+        int have_stat = 0;
+        if (type == PATH_WALK_TYPE_UNKNOWN)
+        {
+            if (fstatat(reader.fd, name, &st, AT_SYMLINK_NOFOLLOW) == 0)
+            {
+                type = path_walk_type_from_mode(st.st_mode);
+                have_stat = 1;
+            }
+        }
+
+        // Report the entry
+        path_walk_entry_t entry;
+        entry.path = state->path;
+        entry.path_len = state->path_len;
+        entry.name = state->path + state->path_len - name_len;
+        entry.name_len = name_len;
+        entry.type = type;
+        entry.depth = depth + 1;
+        entry.parent_fd = reader.fd;
+        entry.post_order = 0;
+
+        int action = state->callback(&entry, state->user_data);
+        if (action == PATH_WALK_STOP)
+        {
+            result = PATH_WALK_STOP;
+            break;
+        }
+
+        // Decide whether to descend
+        int descend = action != PATH_WALK_SKIP && type == PATH_WALK_TYPE_DIR;
+        if (action != PATH_WALK_SKIP && type == PATH_WALK_TYPE_LNK && (state->flags & PATH_WALK_FOLLOW_LINKS))
+        {
+            // Only follow links that resolve to directories
+            descend = fstatat(reader.fd, entry.name, &st, 0) == 0 && S_ISDIR(st.st_mode);
+            have_stat = descend;
+        }
+
+        if (descend)
+        {
+            // Open the child relative to its parent's fd
+            const int open_flags = O_RDONLY | O_DIRECTORY | O_CLOEXEC |
+                (state->flags & PATH_WALK_FOLLOW_LINKS ? 0 : O_NOFOLLOW);
+            const int child_fd = openat(reader.fd, entry.name, open_flags);
+
+            if (child_fd >= 0)
+            {
+                // Never descend into a directory that is already being walked (a link cycle)
+                if (state->flags & PATH_WALK_FOLLOW_LINKS)
+                {
+                    if (!have_stat && fstat(child_fd, &st) != 0)
+                    {
+                        close(child_fd);
+                        state->path_len = base_len;
+                        state->path[base_len] = '\0';
+                        continue;
+                    }
+                    have_stat = 1;
+
+                    const int entered = __fluent_libc_path_walk_enter(state, depth + 1, &st);
+                    if (entered <= 0)
+                    {
+                        close(child_fd);
+                        if (entered < 0)
+                        {
+                            result = -1; // Memory allocation failed
+                            break;
+                        }
+
+                        state->path_len = base_len;
+                        state->path[base_len] = '\0';
+                        continue;
+                    }
+                }
+
+                // Stay on the root's device if requested
+                if (state->flags & PATH_WALK_SAME_DEVICE)
+                {
+                    if (!have_stat && fstat(child_fd, &st) != 0)
+                    {
+                        st.st_dev = state->root_dev;
+                    }
+
+                    if (st.st_dev != state->root_dev)
+                    {
+                        close(child_fd);
+                        state->path_len = base_len;
+                        state->path[base_len] = '\0';
+                        continue;
+                    }
+                }
+
+                const int child_result = __fluent_libc_path_walk_dir(state, child_fd, depth + 1);
+                if (child_result != PATH_WALK_CONTINUE)
+                {
+                    result = child_result;
+                    break;
+                }
+
+                // Report the directory again once its children are done
+                if (state->flags & PATH_WALK_POST_ORDER)
+                {
+                    entry.path = state->path; // The buffer may have moved
+                    entry.name = state->path + state->path_len - name_len;
+                    entry.post_order = 1;
+
+                    if (state->callback(&entry, state->user_data) == PATH_WALK_STOP)
+                    {
+                        result = PATH_WALK_STOP;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Pop the child name off the shared path
+        state->path_len = base_len;
+        state->path[base_len] = '\0';
+    }
+
+    // Propagate read errors
+    if (read < 0 && result == PATH_WALK_CONTINUE)
+    {
+        result = -1;
+    }
+
+    // Restore the path for the caller and release the directory
+    state->path_len = base_len;
+    state->path[base_len] = '\0';
+    path_dir_reader_close(&reader);
+    return result;
+}
+#endif
+
+/**
+ * @brief Recursively walks a directory tree, reporting every entry to a callback.
+ *
+ * The root is resolved once to its canonical absolute form; every reported path
+ * is then built incrementally from it, so entries are normalized without any
+ * per-entry realpath. The root itself is not reported.
+ * Entries that cannot be opened (e.g. permission denied) are reported but not descended,
+ * and so are followed links that lead back to a directory being walked.
+ *
+ * @param root The directory to walk. Must not be NULL or empty.
+ * @param flags A combination of path_walk_flags_t values.
+ * @param callback The function to call for every entry. Must not be NULL.
+ * @param user_data Opaque pointer forwarded to the callback.
+ * @return 1 if the walk completed or was stopped by the callback, 0 on error.
+ */
+FLUENT_LIBC_PATH_API int path_walk(
+    const char *const root,
+    const int flags,
+    const path_walk_callback_t callback,
+    void *const user_data
+)
+{
+#ifdef _WIN32
+    (void)root;
+    (void)flags;
+    (void)callback;
+    (void)user_data;
+    return 0; // Not supported on Windows
+#else
+    // Validate the input
+    if (!root || root[0] == '\0' || !callback)
+    {
+        return 0; // Invalid arguments
+    }
+
+    // Initialize the shared state
+    __fluent_libc_path_walk_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.flags = flags;
+    state.callback = callback;
+    state.user_data = user_data;
+    state.path_cap = PATH_WALK_INITIAL_PATH_CAPACITY > PATH_MAX ? PATH_WALK_INITIAL_PATH_CAPACITY : PATH_MAX;
+    state.path = (char *)malloc(state.path_cap);
+    if (!state.path)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    // Resolve the root once; every child path is derived from it
+    if (!get_real_path_buff(root, state.path))
+    {
+        free(state.path);
+        return 0; // Failed to resolve the root
+    }
+    state.path_len = strlen(state.path);
+
+    // Open the root directory
+    const int fd = open(state.path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        free(state.path);
+        return 0; // Failed to open the root
+    }
+
+    // Remember the root device if the walk must stay on it
+    if (flags & PATH_WALK_SAME_DEVICE)
+    {
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            close(fd);
+            free(state.path);
+            return 0; // Failed to stat the root
+        }
+        state.root_dev = st.st_dev;
+    }
+
+    // Remember the root as the first directory of the descent path
+    if (flags & PATH_WALK_FOLLOW_LINKS)
+    {
+        struct stat st;
+        if (fstat(fd, &st) != 0 || __fluent_libc_path_walk_enter(&state, 0, &st) < 0)
+        {
+            close(fd);
+            free(state.path);
+            return 0; // Failed to stat the root, or memory allocation failed
+        }
+    }
+
+    // Walk the tree
+    const int result = __fluent_libc_path_walk_dir(&state, fd, 0);
+
+    // Release the shared buffers
+    for (size_t i = 0; i < state.buffers_len; i++)
+    {
+        free(state.buffers[i]);
+    }
+    free(state.buffers);
+    free(state.ancestors);
+    free(state.path);
+
+    return result >= 0;
+#endif
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_WALK_LIBRARY_H
@@ -0,0 +1,804 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_PATH_WALK_PARALLEL_LIBRARY_H
+#define FLUENT_LIBC_PATH_WALK_PARALLEL_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Parallel Directory Walker
+// ----------------------------------------
+// Multi-threaded traversal engine built on top of path_walk.h.
+// Provides:
+//   - path_walk_parallel(root, flags, threads, callback, user_data) – Walks a tree across a thread pool
+//
+// Behavior:
+//   - Every worker owns a work-stealing (Chase-Lev) deque of pending directories
+//     (path_pool.h). A worker pops its own deque LIFO (depth-first, cache
+//     friendly) and steals FIFO from random victims when it runs dry, so large
+//     subtrees spread out. A worker that finds nothing to steal sleeps until
+//     new work is pushed.
+//   - Pending directories carry an already-open fd while the process has fds
+//     to spare; past that budget they carry only their path and are reopened.
+//   - Each worker builds child paths in its own path buffer and allocates
+//     directory work items from its own arena, so the hot path takes no locks.
+//   - Entries are packed into per-worker batches that are handed to the calling
+//     thread through a lock-free channel. The callback therefore runs on the
+//     calling thread only and does not need to be thread-safe. The calling
+//     thread sleeps while the channel is empty, and workers sleep while too
+//     many batches are waiting for it (PATH_WALK_PARALLEL_MAX_BATCHES).
+//   - With PATH_WALK_FOLLOW_LINKS every directory is read at most once, by
+//     (device, inode), whichever path reaches it first: link cycles end and a
+//     directory reachable through several links is not walked again.
+//   - Running out of memory, or a directory that cannot be opened or read,
+//     stops the walk and fails it with errno instead of silently reporting a
+//     partial tree. A directory removed while the walk runs is skipped.
+//
+// Limitations:
+//   - Entries arrive in no particular order.
+//   - Returning PATH_WALK_SKIP has no effect (workers run ahead of the callback);
+//     PATH_WALK_STOP aborts the walk as soon as workers notice it.
+//   - PATH_WALK_POST_ORDER is not supported and entry->parent_fd is always -1.
+//
+// Memory Management:
+//   - The entry passed to the callback is only valid for the duration of the call.
+//   - Work item arenas are released once the walk finishes.
+//
+// Dependencies:
+//   - path_walk.h for the directory reader and entry types, path_pool.h for the workers
+//   - POSIX threads and the GCC/Clang atomic builtins (path_atomic.h)
+//   - Windows: not supported, path_walk_parallel() returns 0
+//
+// Example:
+// ----------------------------------------
+//   static int count_entry(const path_walk_entry_t *entry, void *user_data)
+//   {
+//       (*(size_t *)user_data)++;
+//       return PATH_WALK_CONTINUE;
+//   }
+//
+//   size_t count = 0;
+//   path_walk_parallel("/data", 0, 8, count_entry, &count);
+//
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#include "path_arena.h"
+#include "path_atomic.h"   // For the lock-free deques and channel
+#include "path_identity.h" // For the visited directory set
+#include "path_pool.h"     // For the work-stealing workers
+#include "path_walk.h"
+#ifndef _WIN32
+#   include <pthread.h>      // For the worker threads
+#   include <sys/resource.h> // For getrlimit
+#endif
+
+// ============= MACROS =============
+#ifndef PATH_WALK_PARALLEL_BATCH_SIZE
+#   define PATH_WALK_PARALLEL_BATCH_SIZE (64 * 1024) // Bytes of entries per result batch
+#endif
+
+#ifndef PATH_WALK_PARALLEL_MAX_BATCHES
+#   define PATH_WALK_PARALLEL_MAX_BATCHES 1024 // Batches in flight before workers wait for the consumer
+#endif
+
+#ifndef _WIN32
+// ============= PARALLEL WALK =============
+/**
+ * @brief A directory waiting to be read.
+ */
+typedef struct
+{
+    int fd;          // Open fd of the directory, or -1 if it must be reopened by path
+    size_t depth;    // Depth of the directory below the root
+    size_t path_len; // Length of path
+    char path[];     // Normalized path of the directory
+} __fluent_libc_path_walk_item_t;
+
+/**
+ * @brief A packed entry inside a result batch, followed by its NUL-terminated path.
+ */
+typedef struct
+{
+    size_t path_len;       // Length of the path
+    size_t name_len;       // Length of the final component
+    size_t depth;          // Depth below the root
+    path_walk_type_t type; // Entry type
+} __fluent_libc_path_walk_record_t;
+
+/**
+ * @brief A block of packed entries handed from a worker to the consumer.
+ */
+typedef struct __fluent_libc_path_walk_batch
+{
+    struct __fluent_libc_path_walk_batch *next; // Next batch in the channel
+    size_t used;                                // Bytes of records in data
+    size_t cap;                                 // Capacity of data
+    char data[];                                // Packed records
+} __fluent_libc_path_walk_batch_t;
+
+/**
+ * @brief Per-worker state of a parallel walk.
+ */
+typedef struct
+{
+    char *path;                             // Path buffer used to build child paths
+    size_t path_cap;                        // Capacity of the path buffer
+    char *buffer;                           // getdents64 buffer
+    path_arena_t arena;                     // Work item storage
+    __fluent_libc_path_walk_batch_t *batch; // Batch being filled
+} __fluent_libc_path_walk_worker_t;
+
+/**
+ * @brief Shared state of a parallel walk.
+ */
+typedef struct
+{
+    __fluent_libc_path_walk_worker_t *workers;              // Per-worker state
+    __fluent_libc_path_walk_batch_t *channel;               // Lock-free stack of full batches (atomic)
+    size_t batches;                                         // Batches produced but not yet consumed (atomic)
+    int consumer_waiting;                                   // Set while the calling thread sleeps on the pool (atomic)
+    size_t producers_waiting;                               // Workers held back until the consumer catches up (atomic)
+    pthread_mutex_t lock;                                   // Guards drained
+    pthread_cond_t drained;                                 // Signaled when the consumer has freed batches
+    long open_fds;                                          // Directory fds held by queued items (atomic)
+    long max_open_fds;                                      // Budget for queued directory fds
+    int error;                                              // First error (errno value), 0 if none (atomic)
+    pthread_mutex_t visited_lock;                           // Guards visited
+    path_id_cache_t visited;                                // Directories already queued (PATH_WALK_FOLLOW_LINKS)
+    int flags;                                              // path_walk_flags_t
+    dev_t root_dev;                                         // Device of the root
+} __fluent_libc_path_walk_shared_t;
+
+/**
+ * @brief Records the first error and stops the pool.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_walk_fail(__fluent_libc_path_pool_t *const pool, const int error)
+{
+    __fluent_libc_path_walk_shared_t *shared = (__fluent_libc_path_walk_shared_t *)pool->user_data;
+    int expected = 0;
+    __FLUENT_LIBC_PATH_ATOMIC_CAS(&shared->error, &expected, error, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    __fluent_libc_path_pool_stop(pool);
+}
+
+/**
+ * @brief Marks a directory as visited.
+ *
+ * @return 1 if it was not visited before, 0 if it was, -1 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_walk_first_visit(
+    __fluent_libc_path_walk_shared_t *const shared,
+    const struct stat *const st
+)
+{
+    path_id_t id;
+    id.dev = (uint64_t)st->st_dev;
+    id.ino = (uint64_t)st->st_ino;
+
+    pthread_mutex_lock(&shared->visited_lock);
+    const int inserted = path_id_cache_insert(&shared->visited, id);
+    pthread_mutex_unlock(&shared->visited_lock);
+    return inserted;
+}
+
+/**
+ * @brief Publishes a worker's current batch to the consumer.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_walk_flush(
+    __fluent_libc_path_pool_t *const pool,
+    __fluent_libc_path_walk_worker_t *const worker
+)
+{
+    __fluent_libc_path_walk_shared_t *shared = (__fluent_libc_path_walk_shared_t *)pool->user_data;
+    __fluent_libc_path_walk_batch_t *batch = worker->batch;
+    if (!batch || batch->used == 0)
+    {
+        return; // Nothing to publish
+    }
+
+    // Push onto the channel (Treiber stack; the consumer takes the whole list at once)
+    batch->next = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&shared->channel, __ATOMIC_RELAXED);
+    while (!__FLUENT_LIBC_PATH_ATOMIC_CAS(
+        &shared->channel, &batch->next, batch, 1, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+    {
+    }
+
+    __FLUENT_LIBC_PATH_ATOMIC_ADD(&shared->batches, 1, __ATOMIC_SEQ_CST);
+    worker->batch = NULL;
+
+    // The consumer sets consumer_waiting before re-checking the channel, so one of us sees the other
+    if (__FLUENT_LIBC_PATH_ATOMIC_LOAD(&shared->consumer_waiting, __ATOMIC_SEQ_CST))
+    {
+        __fluent_libc_path_pool_notify(pool);
+    }
+
+    // Apply backpressure if the consumer is falling behind
+    if (__FLUENT_LIBC_PATH_ATOMIC_LOAD(&shared->batches, __ATOMIC_SEQ_CST) > PATH_WALK_PARALLEL_MAX_BATCHES)
+    {
+        pthread_mutex_lock(&shared->lock);
+        __FLUENT_LIBC_PATH_ATOMIC_ADD(&shared->producers_waiting, 1, __ATOMIC_SEQ_CST);
+        while (__FLUENT_LIBC_PATH_ATOMIC_LOAD(&shared->batches, __ATOMIC_SEQ_CST) > PATH_WALK_PARALLEL_MAX_BATCHES &&
+               !__FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool->stop, __ATOMIC_SEQ_CST))
+        {
+            pthread_cond_wait(&shared->drained, &shared->lock);
+        }
+        __FLUENT_LIBC_PATH_ATOMIC_SUB(&shared->producers_waiting, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&shared->lock);
+    }
+}
+
+/**
+ * @brief Appends an entry to a worker's batch, publishing the batch when full.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_walk_emit(
+    __fluent_libc_path_pool_t *const pool,
+    __fluent_libc_path_walk_worker_t *const worker,
+    const char *const path,
+    const size_t path_len,
+    const size_t name_len,
+    const size_t depth,
+    const path_walk_type_t type
+)
+{
+    // Records are padded so the next header stays aligned
+    const size_t size = (sizeof(__fluent_libc_path_walk_record_t) + path_len + 1 + 7) & ~(size_t)7;
+
+    // Publish the current batch if the record does not fit
+    if (worker->batch && worker->batch->cap - worker->batch->used < size)
+    {
+        __fluent_libc_path_walk_flush(pool, worker);
+    }
+
+    // Start a new batch
+    if (!worker->batch)
+    {
+        const size_t cap = size > PATH_WALK_PARALLEL_BATCH_SIZE ? size : PATH_WALK_PARALLEL_BATCH_SIZE;
+        worker->batch = (__fluent_libc_path_walk_batch_t *)malloc(sizeof(__fluent_libc_path_walk_batch_t) + cap);
+        if (!worker->batch)
+        {
+            return 0; // Memory allocation failed
+        }
+
+        worker->batch->used = 0;
+        worker->batch->cap = cap;
+    }
+
+    // Pack the record header followed by the path
+    __fluent_libc_path_walk_record_t *record =
+        (__fluent_libc_path_walk_record_t *)(worker->batch->data + worker->batch->used);
+    record->path_len = path_len;
+    record->name_len = name_len;
+    record->depth = depth;
+    record->type = type;
+    memcpy(record + 1, path, path_len);
+    ((char *)(record + 1))[path_len] = '\0';
+    worker->batch->used += size;
+    return 1;
+}
+
+/**
+ * @brief Ensures a worker's path buffer can hold the given number of bytes.
+ *
+ * @return 1 on success, 0 if memory allocation failed.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_walk_reserve(__fluent_libc_path_walk_worker_t *const worker, const size_t needed)
+{
+    if (needed <= worker->path_cap)
+    {
+        return 1;
+    }
+
+    size_t cap = worker->path_cap * 2;
+    while (cap < needed)
+    {
+        cap *= 2;
+    }
+
+    char *path = (char *)realloc(worker->path, cap);
+    if (!path)
+    {
+        return 0; // Memory allocation failed
+    }
+
+    worker->path = path;
+    worker->path_cap = cap;
+    return 1;
+}
+
+/**
+ * @brief Pool idle hook: publishes the worker's partial batch.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_walk_idle(__fluent_libc_path_pool_t *const pool, const size_t index)
+{
+    __fluent_libc_path_walk_shared_t *shared = (__fluent_libc_path_walk_shared_t *)pool->user_data;
+    __fluent_libc_path_walk_flush(pool, &shared->workers[index]);
+}
+
+/**
+ * @brief Pool discard hook: closes the fd of an unprocessed item.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_walk_discard(__fluent_libc_path_pool_t *const pool, void *const data)
+{
+    (void)pool;
+    const __fluent_libc_path_walk_item_t *item = (const __fluent_libc_path_walk_item_t *)data;
+    if (item->fd >= 0)
+    {
+        close(item->fd);
+    }
+}
+
+/**
+ * @brief Pool process hook: reads one directory, emitting entries and queueing subdirectories.
+ */
+FLUENT_LIBC_PATH_API void __fluent_libc_path_walk_process(
+    __fluent_libc_path_pool_t *const pool,
+    const size_t index,
+    void *const data
+)
+{
+    __fluent_libc_path_walk_shared_t *shared = (__fluent_libc_path_walk_shared_t *)pool->user_data;
+    __fluent_libc_path_walk_worker_t *worker = &shared->workers[index];
+    __fluent_libc_path_walk_item_t *item = (__fluent_libc_path_walk_item_t *)data;
+
+    // Reopen the directory by path if it was queued without an fd
+    int fd = item->fd;
+    if (fd >= 0)
+    {
+        __FLUENT_LIBC_PATH_ATOMIC_SUB(&shared->open_fds, 1, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        fd = open(item->path, O_RDONLY | O_DIRECTORY | O_CLOEXEC |
+            (shared->flags & PATH_WALK_FOLLOW_LINKS ? 0 : O_NOFOLLOW));
+        if (fd < 0)
+        {
+            if (errno != ENOENT)
+            {
+                __fluent_libc_path_walk_fail(pool, errno);
+            }
+            return; // The directory vanished or is not accessible
+        }
+    }
+
+    path_dir_reader_t reader;
+    if (!path_dir_reader_open(&reader, fd, worker->buffer, PATH_WALK_BUFFER_SIZE))
+    {
+        __fluent_libc_path_walk_fail(pool, errno);
+        return; // Failed to open the directory stream
+    }
+
+    // Seed the worker's path buffer with the directory path
+    if (!__fluent_libc_path_walk_reserve(worker, item->path_len + 2))
+    {
+        path_dir_reader_close(&reader);
+        __fluent_libc_path_walk_fail(pool, ENOMEM);
+        return; // Memory allocation failed
+    }
+    memcpy(worker->path, item->path, item->path_len);
+    size_t base_len = item->path_len;
+    if (base_len == 0 || worker->path[base_len - 1] != PATH_SEPARATOR)
+    {
+        worker->path[base_len++] = PATH_SEPARATOR;
+    }
+
+    const char *name;
+    size_t name_len;
+    path_walk_type_t type;
+    int read = 0;
+    while (!__FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool->stop, __ATOMIC_RELAXED) &&
+           (read = path_dir_reader_next(&reader, &name, &name_len, &type)) > 0)
+    {
+        // Build the child path in the worker's buffer
+        if (!__fluent_libc_path_walk_reserve(worker, base_len + name_len + 1))
+        {
+            __fluent_libc_path_walk_fail(pool, ENOMEM);
+            break; // Memory allocation failed
+        }
+        memcpy(worker->path + base_len, name, name_len);
+        const size_t path_len = base_len + name_len;
+        worker->path[path_len] = '\0';
+
+        // Fall back to fstatat only when the filesystem did not report a type
+        struct stat st;
+        int have_stat = 0;
+        if (type == PATH_WALK_TYPE_UNKNOWN && fstatat(reader.fd, worker->path + base_len, &st, AT_SYMLINK_NOFOLLOW) == 0)
+        {
+            type = path_walk_type_from_mode(st.st_mode);
+            have_stat = 1;
+        }
+
+        if (!__fluent_libc_path_walk_emit(pool, worker, worker->path, path_len, name_len, item->depth + 1, type))
+        {
+            __fluent_libc_path_walk_fail(pool, ENOMEM);
+            break; // Memory allocation failed
+        }
+
+        // Decide whether the child must be queued
+        int descend = type == PATH_WALK_TYPE_DIR;
+        if (type == PATH_WALK_TYPE_LNK && (shared->flags & PATH_WALK_FOLLOW_LINKS))
+        {
+            descend = fstatat(reader.fd, worker->path + base_len, &st, 0) == 0 && S_ISDIR(st.st_mode);
+            have_stat = descend;
+        }
+
+        if (!descend)
+        {
+            continue;
+        }
+
+        if ((shared->flags & (PATH_WALK_SAME_DEVICE | PATH_WALK_FOLLOW_LINKS)) && !have_stat &&
+            fstatat(reader.fd, worker->path + base_len, &st, AT_SYMLINK_NOFOLLOW) != 0)
+        {
+            continue; // Removed meanwhile
+        }
+
+        if ((shared->flags & PATH_WALK_SAME_DEVICE) && st.st_dev != shared->root_dev)
+        {
+            continue; // The child lives on another filesystem
+        }
+
+        // Links can lead back to a directory that is already queued, or to an ancestor
+        if (shared->flags & PATH_WALK_FOLLOW_LINKS)
+        {
+            const int first = __fluent_libc_path_walk_first_visit(shared, &st);
+            if (first < 0)
+            {
+                __fluent_libc_path_walk_fail(pool, ENOMEM);
+                break; // Memory allocation failed
+            }
+
+            if (!first)
+            {
+                continue; // Already walked, or being walked
+            }
+        }
+
+        // Queue the child, keeping its fd open while the budget allows it
+        __fluent_libc_path_walk_item_t *child = (__fluent_libc_path_walk_item_t *)path_arena_alloc(
+            &worker->arena, sizeof(__fluent_libc_path_walk_item_t) + path_len + 1);
+        if (!child)
+        {
+            __fluent_libc_path_walk_fail(pool, ENOMEM);
+            break; // Memory allocation failed
+        }
+
+        child->fd = -1;
+        child->depth = item->depth + 1;
+        child->path_len = path_len;
+        memcpy(child->path, worker->path, path_len + 1);
+
+        if (__FLUENT_LIBC_PATH_ATOMIC_ADD(&shared->open_fds, 1, __ATOMIC_RELAXED) < shared->max_open_fds)
+        {
+            child->fd = openat(reader.fd, worker->path + base_len, O_RDONLY | O_DIRECTORY | O_CLOEXEC |
+                (shared->flags & PATH_WALK_FOLLOW_LINKS ? 0 : O_NOFOLLOW));
+        }
+
+        if (child->fd < 0)
+        {
+            __FLUENT_LIBC_PATH_ATOMIC_SUB(&shared->open_fds, 1, __ATOMIC_RELAXED);
+        }
+
+        if (!__fluent_libc_path_pool_push(pool, index, child))
+        {
+            if (child->fd >= 0)
+            {
+                close(child->fd);
+                __FLUENT_LIBC_PATH_ATOMIC_SUB(&shared->open_fds, 1, __ATOMIC_RELAXED);
+            }
+            __fluent_libc_path_walk_fail(pool, ENOMEM);
+            break; // Memory allocation failed
+        }
+    }
+
+    // Propagate read errors
+    if (read < 0)
+    {
+        __fluent_libc_path_walk_fail(pool, errno);
+    }
+
+    path_dir_reader_close(&reader);
+}
+
+/**
+ * @brief Hands every published batch to the callback on the calling thread.
+ *
+ * @return 1 if the callback requested the walk to stop, 0 otherwise.
+ */
+FLUENT_LIBC_PATH_API int __fluent_libc_path_walk_consume(
+    __fluent_libc_path_walk_shared_t *const shared,
+    const int stopped,
+    const path_walk_callback_t callback,
+    void *const user_data
+)
+{
+    // Take the whole channel at once
+    __fluent_libc_path_walk_batch_t *list = __FLUENT_LIBC_PATH_ATOMIC_EXCHANGE(&shared->channel, NULL, __ATOMIC_ACQUIRE);
+
+    // The channel is a stack; reverse it to deliver batches in publication order
+    __fluent_libc_path_walk_batch_t *ordered = NULL;
+    while (list)
+    {
+        __fluent_libc_path_walk_batch_t *next = list->next;
+        list->next = ordered;
+        ordered = list;
+        list = next;
+    }
+
+    int stop = stopped;
+    while (ordered)
+    {
+        __fluent_libc_path_walk_batch_t *batch = ordered;
+        ordered = batch->next;
+
+        // Replay the packed records unless the walk was already stopped
+        size_t offset = 0;
+        while (!stop && offset < batch->used)
+        {
+            const __fluent_libc_path_walk_record_t *record =
+                (const __fluent_libc_path_walk_record_t *)(batch->data + offset);
+            const char *path = (const char *)(record + 1);
+
+            path_walk_entry_t entry;
+            entry.path = path;
+            entry.path_len = record->path_len;
+            entry.name = path + record->path_len - record->name_len;
+            entry.name_len = record->name_len;
+            entry.type = record->type;
+            entry.depth = record->depth;
+            entry.parent_fd = -1;
+            entry.post_order = 0;
+
+            stop = callback(&entry, user_data) == PATH_WALK_STOP;
+            offset += (sizeof(__fluent_libc_path_walk_record_t) + record->path_len + 1 + 7) & ~(size_t)7;
+        }
+
+        __FLUENT_LIBC_PATH_ATOMIC_SUB(&shared->batches, 1, __ATOMIC_SEQ_CST);
+        free(batch);
+    }
+
+    // Release the workers held back by the backpressure
+    if (__FLUENT_LIBC_PATH_ATOMIC_LOAD(&shared->producers_waiting, __ATOMIC_SEQ_CST) > 0)
+    {
+        pthread_mutex_lock(&shared->lock);
+        pthread_cond_broadcast(&shared->drained);
+        pthread_mutex_unlock(&shared->lock);
+    }
+
+    return stop;
+}
+#endif
+
+/**
+ * @brief Walks a directory tree using a pool of work-stealing threads.
+ *
+ * Reports the same entries as path_walk() (root excluded), in no particular order,
+ * except that with PATH_WALK_FOLLOW_LINKS each directory is read only once.
+ * The callback is always invoked on the calling thread.
+ *
+ * @param root The directory to walk. Must not be NULL or empty.
+ * @param flags PATH_WALK_FOLLOW_LINKS and/or PATH_WALK_SAME_DEVICE.
+ * @param threads The number of worker threads, or 0 to use one per online CPU.
+ * @param callback The function to call for every entry. Must not be NULL.
+ * @param user_data Opaque pointer forwarded to the callback.
+ * @return 1 if the walk completed or was stopped by the callback, 0 on error
+ *         (errno is set; ENOMEM if the walk ran out of memory part way).
+ */
+FLUENT_LIBC_PATH_API int path_walk_parallel(
+    const char *const root,
+    const int flags,
+    const size_t threads,
+    const path_walk_callback_t callback,
+    void *const user_data
+)
+{
+#ifdef _WIN32
+    (void)root;
+    (void)flags;
+    (void)threads;
+    (void)callback;
+    (void)user_data;
+    return 0; // Not supported on Windows
+#else
+    // Validate the input
+    if (!root || root[0] == '\0' || !callback)
+    {
+        return 0; // Invalid arguments
+    }
+
+    // Resolve the root once; every child path is derived from it
+    char resolved[PATH_MAX];
+    if (!get_real_path_buff(root, resolved))
+    {
+        return 0; // Failed to resolve the root
+    }
+    const size_t resolved_len = strlen(resolved);
+
+    const int fd = open(resolved, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return 0; // Failed to open the root
+    }
+
+    // Set up the shared state
+    __fluent_libc_path_walk_shared_t shared;
+    memset(&shared, 0, sizeof(shared));
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&shared.channel, NULL, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&shared.batches, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&shared.open_fds, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&shared.error, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&shared.consumer_waiting, 0, __ATOMIC_RELAXED);
+    __FLUENT_LIBC_PATH_ATOMIC_STORE(&shared.producers_waiting, 0, __ATOMIC_RELAXED);
+    shared.flags = flags;
+
+    // Spend at most half of the fd limit on queued directories
+    struct rlimit limit;
+    shared.max_open_fds = getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY
+        ? (long)(limit.rlim_cur / 2)
+        : 512;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return 0; // Failed to stat the root
+    }
+    shared.root_dev = st.st_dev;
+
+    // The root is the first visited directory
+    pthread_mutex_init(&shared.visited_lock, NULL);
+    if (flags & PATH_WALK_FOLLOW_LINKS)
+    {
+        if (!path_id_cache_init(&shared.visited) || __fluent_libc_path_walk_first_visit(&shared, &st) < 0)
+        {
+            if (shared.visited.slots)
+            {
+                path_id_cache_destroy(&shared.visited);
+            }
+            pthread_mutex_destroy(&shared.visited_lock);
+            close(fd);
+            errno = ENOMEM;
+            return 0; // Memory allocation failed
+        }
+    }
+
+    __fluent_libc_path_pool_t pool;
+    if (!__fluent_libc_path_pool_init(&pool, threads, __fluent_libc_path_walk_process,
+                                      __fluent_libc_path_walk_idle, __fluent_libc_path_walk_discard, &shared))
+    {
+        if (shared.visited.slots)
+        {
+            path_id_cache_destroy(&shared.visited);
+        }
+        pthread_mutex_destroy(&shared.visited_lock);
+        close(fd);
+        errno = ENOMEM;
+        return 0; // Memory allocation failed
+    }
+
+    // Allocate the per-worker buffers
+    int ok = 1;
+    shared.workers = (__fluent_libc_path_walk_worker_t *)calloc(pool.threads, sizeof(__fluent_libc_path_walk_worker_t));
+    ok = shared.workers != NULL;
+    for (size_t i = 0; ok && i < pool.threads; i++)
+    {
+        shared.workers[i].path_cap = PATH_MAX;
+        shared.workers[i].path = (char *)malloc(PATH_MAX);
+        shared.workers[i].buffer = (char *)malloc(PATH_WALK_BUFFER_SIZE);
+        ok = shared.workers[i].path && shared.workers[i].buffer;
+    }
+
+    // Queue the root on the first worker
+    __fluent_libc_path_walk_item_t *item = NULL;
+    if (ok)
+    {
+        item = (__fluent_libc_path_walk_item_t *)path_arena_alloc(
+            &shared.workers[0].arena, sizeof(__fluent_libc_path_walk_item_t) + resolved_len + 1);
+        ok = item != NULL;
+    }
+
+    if (ok)
+    {
+        item->fd = fd;
+        item->depth = 0;
+        item->path_len = resolved_len;
+        memcpy(item->path, resolved, resolved_len + 1);
+        __FLUENT_LIBC_PATH_ATOMIC_ADD(&shared.open_fds, 1, __ATOMIC_RELAXED);
+        ok = __fluent_libc_path_pool_push(&pool, 0, item);
+    }
+
+    if (!ok)
+    {
+        close(fd);
+    }
+
+    // Run the pool while draining the channel on this thread
+    pthread_mutex_init(&shared.lock, NULL);
+    pthread_cond_init(&shared.drained, NULL);
+    const size_t started = ok ? __fluent_libc_path_pool_start(&pool) : 0;
+    ok = ok && started > 0;
+    if (!ok)
+    {
+        __fluent_libc_path_pool_stop(&pool);
+    }
+
+    int stop = !ok;
+    for (;;)
+    {
+        if (__fluent_libc_path_walk_consume(&shared, stop, callback, user_data) && !stop)
+        {
+            stop = 1;
+            __fluent_libc_path_pool_stop(&pool);
+        }
+
+        // Sleep until a batch is published or every worker has exited;
+        // setting consumer_waiting before re-checking the channel pairs with the flush
+        pthread_mutex_lock(&pool.lock);
+        __FLUENT_LIBC_PATH_ATOMIC_STORE(&shared.consumer_waiting, 1, __ATOMIC_SEQ_CST);
+        while (!__FLUENT_LIBC_PATH_ATOMIC_LOAD(&shared.channel, __ATOMIC_SEQ_CST) && __FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool.running, __ATOMIC_SEQ_CST) > 0)
+        {
+            pthread_cond_wait(&pool.owner, &pool.lock);
+        }
+        __FLUENT_LIBC_PATH_ATOMIC_STORE(&shared.consumer_waiting, 0, __ATOMIC_SEQ_CST);
+        const int finished = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&pool.running, __ATOMIC_SEQ_CST) == 0;
+        pthread_mutex_unlock(&pool.lock);
+
+        if (finished)
+        {
+            break;
+        }
+    }
+    __fluent_libc_path_pool_join(&pool, started);
+    __fluent_libc_path_walk_consume(&shared, stop, callback, user_data);
+
+    // Release the per-worker state
+    if (shared.workers)
+    {
+        for (size_t i = 0; i < pool.threads; i++)
+        {
+            free(shared.workers[i].path);
+            free(shared.workers[i].buffer);
+            free(shared.workers[i].batch);
+            path_arena_destroy(&shared.workers[i].arena);
+        }
+        free(shared.workers);
+    }
+
+    if (shared.visited.slots)
+    {
+        path_id_cache_destroy(&shared.visited);
+    }
+    pthread_cond_destroy(&shared.drained);
+    pthread_mutex_destroy(&shared.lock);
+    pthread_mutex_destroy(&shared.visited_lock);
+
+    // A walk cut short by an error is not a complete walk
+    const int error = __FLUENT_LIBC_PATH_ATOMIC_LOAD(&shared.error, __ATOMIC_SEQ_CST);
+    if (ok && error)
+    {
+        errno = error;
+        ok = 0;
+    }
+
+    return ok;
+#endif
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_PATH_WALK_PARALLEL_LIBRARY_H